@@ -66,6 +66,38 @@ extern "C"
 #define HEBREW_NUMBER_BUFFER_SIZE 17
 #define HEBREW_WNUMBER_BUFFER_SIZE 9
 
+/** @def HDATE_MAX_HOLYDAY_EVENTS
+  @brief most holydays in a year, see hdate_get_holyday_events
+*/
+#define HDATE_MAX_HOLYDAY_EVENTS 64
+
+/** @def HDATE_NEXT_HOLYDAY_YEARS
+  @brief years searched by hdate_next_holyday
+*/
+#define HDATE_NEXT_HOLYDAY_YEARS 2
+
+/** @def HDATE_EVENT_HOLYDAY
+  @brief event types of hdate_event_iter, use 1 << type in type masks
+*/
+#define HDATE_EVENT_HOLYDAY 0
+#define HDATE_EVENT_PARASHA 1
+#define HDATE_EVENT_OMER 2
+#define HDATE_EVENT_ROSH_CHODESH 3
+#define HDATE_EVENT_SPECIAL_SHABBAT 4
+#define HDATE_EVENT_TYPES 5
+
+/** @def HDATE_SHABBAT_SHUVA
+  @brief special shabbat numbers, the values of HDATE_EVENT_SPECIAL_SHABBAT
+*/
+#define HDATE_SHABBAT_SHUVA 1
+#define HDATE_SHABBAT_SHEKALIM 2
+#define HDATE_SHABBAT_ZACHOR 3
+#define HDATE_SHABBAT_PARAH 4
+#define HDATE_SHABBAT_HACHODESH 5
+#define HDATE_SHABBAT_HAGADOL 6
+#define HDATE_SHABBAT_CHAZON 7
+#define HDATE_SHABBAT_NACHAMU 8
+
 
 /** @struct hdate_struct
   @brief libhdate Hebrew date struct
@@ -100,6 +132,99 @@ typedef struct
 	int hd_weeks;
 } hdate_struct;
 
+/** @struct hdate_year_info
+  @brief libhdate Hebrew year descriptor, see hdate_get_year_info
+*/
+typedef struct
+{
+	/** The number of the hebrew year. */
+	int year;
+	/** The julian day number of 1 tishrey this year. */
+	int jd_tishrey1;
+	/** The length of the year in days. */
+	int size_of_year;
+	/** The number type of year 1..14 (see hdate_get_year_type). */
+	int year_type;
+	/** True if the year has Adar I and Adar II. */
+	int leap;
+} hdate_year_info;
+
+/** @struct hdate_date
+  @brief Hebrew day, month and year, see hdate_jd_range_to_hdate
+*/
+typedef struct
+{
+	/** The number of day in the hebrew month (1..30). */
+	int day;
+	/** The number of the hebrew month 1..14 (1 - tishre, 13 - adar 1, 14 - adar 2). */
+	int month;
+	/** The number of the hebrew year. */
+	int year;
+} hdate_date;
+
+/** @struct hdate_holyday_event
+  @brief A holyday in a Hebrew year, see hdate_get_holyday_events
+*/
+typedef struct
+{
+	/** The number of days passed since 1 tishrey, 1 for 1 tishrey. */
+	int days;
+	/** The number of holyday (see hdate_get_holyday). */
+	int holyday;
+} hdate_holyday_event;
+
+/** @struct hdate_event
+  @brief A calendar event, see hdate_event_iter_next
+*/
+typedef struct
+{
+	/** The julian day of the event. */
+	int jd;
+	/** The event type (HDATE_EVENT_HOLYDAY etc.). */
+	int type;
+	/** The holyday, parasha, omer day, new hebrew month or special shabbat number. */
+	int value;
+} hdate_event;
+
+/** @struct hdate_event_iter
+  @brief Iterator over the calendar events of a range of days
+*/
+typedef struct
+{
+	/** The last julian day of the range. */
+	int last_jd;
+	/** True for diaspora holydays and readings. */
+	int diaspora;
+	/** The event types to give, bit 1 << type for each type. */
+	int type_mask;
+	/** The next julian day of each event type, after last_jd if none. */
+	int next_jd[HDATE_EVENT_TYPES];
+	/** The value of the next event of each event type. */
+	int next_value[HDATE_EVENT_TYPES];
+	/** The julian day of the next Simhat tora reading. */
+	int simchat_tora_jd;
+	/** The julian days of a year's special shabbats, by number (0 is unused). */
+	int special_shabbat_jd[HDATE_SHABBAT_NACHAMU + 1];
+} hdate_event_iter;
+
+/** @def HDATE_FMT_BUFFER_SIZE
+  @brief size of the scratch space of a hdate_fmt_ctx
+*/
+#define HDATE_FMT_BUFFER_SIZE 256
+
+/** @struct hdate_fmt_ctx
+  @brief Formatting context, see hdate_fmt_ctx_init
+  @note Holds everything the formatting functions would otherwise keep
+  in globals; give each thread its own.
+*/
+typedef struct
+{
+	/** HDATE_STRING_HEBREW or HDATE_STRING_LOCAL, from the locale. */
+	int hebrew_form;
+	/** The scratch space the formatted strings are written to. */
+	char buffer[HDATE_FMT_BUFFER_SIZE];
+} hdate_fmt_ctx;
+
 /*************************************************************/
 /*************************************************************/
 
@@ -139,6 +264,24 @@ hdate_set_hdate (hdate_struct *h, int d, int m, int y);
 hdate_struct *
 hdate_set_jd (hdate_struct *h, int jd);
 
+/**
+ @brief move date structure to the next day
+
+ @param h pointer this hdate struct.
+ @return pointer to this hdate struct
+ */
+hdate_struct *
+hdate_next_day (hdate_struct *h);
+
+/**
+ @brief move date structure to the previous day
+
+ @param h pointer this hdate struct.
+ @return pointer to this hdate struct
+ */
+hdate_struct *
+hdate_prev_day (hdate_struct *h);
+
 /*************************************************************/
 /*************************************************************/
 
@@ -154,13 +297,75 @@ hdate_set_jd (hdate_struct *h, int jd);
  @param diaspora if true give diaspora holydays
  @param short_format A short flag (true - returns a short string, false returns a long string).
 
- @warning This was originally written using a local static string,
-          calling for output to be copied away.
-
+ @see hdate_format_date, for formatting without allocation
 */
 char *
 hdate_get_format_date (hdate_struct const * h, int diaspora, int s);
 
+/**
+ @brief Write a number as a Hebrew numeral (gematria)
+
+ Days of the month come from a table, other numbers (e.g. years,
+ 5785 is התשפ"ה) are composed letter by letter. Nothing is allocated.
+
+ @param buffer at least HEBREW_NUMBER_BUFFER_SIZE bytes
+ @param n The number 1..10999
+ @param short_form A short flag, no geresh and gershayim.
+ @return the length of the string in bytes, 0 if n is out of range
+*/
+int
+hdate_format_hebrew_number (char *buffer, int n, int short_form);
+
+/**
+ @brief Set up a formatting context, deciding the language once.
+
+ Checks the locale (see hdate_is_hebrew_locale), so call it once per
+ thread, or once before starting the threads and copy the context.
+ The language can be changed afterwards by setting hebrew_form.
+
+ @param ctx the context to set up
+ @return ctx
+*/
+hdate_fmt_ctx *
+hdate_fmt_ctx_init (hdate_fmt_ctx *ctx);
+
+/**
+ @brief Format the hebrew date in the scratch space of a context.
+
+ Like hdate_format_date, but in the language of the context instead of
+ the current locale. Reentrant: threads with their own contexts can
+ format at the same time.
+
+ @return a pointer to the formatted date in ctx->buffer, valid until the
+ next use of the context, or NULL if the date can not be formatted.
+ Long dates are truncated to HDATE_FMT_BUFFER_SIZE - 1 bytes.
+
+ @param ctx the formatting context
+ @param h The hdate_struct of the date to print.
+ @param diaspora if true give diaspora holydays
+ @param s A short flag (true - short string, false long string).
+*/
+char *
+hdate_fmt_date (hdate_fmt_ctx *ctx, hdate_struct const * h, int diaspora, int s);
+
+/**
+ @brief Write the hebrew date into a caller supplied buffer.
+
+ Writes in one pass, without allocating, and truncates like snprintf.
+
+ @return the length of the formatted date, not counting the end of
+ string, even if it did not fit in the buffer, or -1 if the day or year
+ of the date can not be formatted.
+
+ @param h The hdate_struct of the date to print.
+ @param diaspora if true give diaspora holydays
+ @param s A short flag (true - short string, false long string).
+ @param buffer the output buffer, may be NULL if size is 0
+ @param size the size of the output buffer
+*/
+int
+hdate_format_date (hdate_struct const * h, int diaspora, int s, char *buffer, int size);
+
 /**
  @brief get the number of hebrew parasha.
 
@@ -182,6 +387,31 @@ hdate_get_parasha (hdate_struct const * h, int diaspora);
 int
 hdate_get_holyday (hdate_struct const * h, int diaspora);
 
+/**
+ @brief get the holidays of a hebrew year, in date order.
+
+ @param hebrew_year the hebrew year.
+ @param diaspora if true give diaspora holidays
+ @param events return the holidays of the year
+ @param max_events size of events
+ @return the number of holidays written to events.
+*/
+int
+hdate_get_holyday_events (int hebrew_year, int diaspora, hdate_holyday_event events[], int max_events);
+
+/**
+ @brief get the next holiday of some holiday types.
+
+ @param jd the julian day to search from, a holiday on jd is returned
+ @param diaspora if true give diaspora holidays
+ @param type_mask holiday types to look for, bit 1 << type for each type
+   (see hdate_get_holyday_type)
+ @param holyday return the number of holiday, 0 if none was found
+ @return the julian day of the holiday, 0 if none was found.
+*/
+int
+hdate_next_holyday (int jd, int diaspora, int type_mask, int *holyday);
+
 /*************************************************************/
 /*************************************************************/
 
@@ -312,6 +542,31 @@ hdate_get_omer_day(hdate_struct const * h);
 int
 hdate_get_holyday_type (int holyday);
 
+/**
+ @brief start iterating over the calendar events of a range of days.
+
+ @param it pointer to the iterator state.
+ @param first_jd the first julian day of the range.
+ @param last_jd the last julian day of the range.
+ @param diaspora if true give diaspora holidays and readings
+ @param type_mask event types to give, bit 1 << type for each type
+   (HDATE_EVENT_HOLYDAY etc.)
+*/
+void
+hdate_event_iter_init (hdate_event_iter *it, int first_jd, int last_jd, int diaspora, int type_mask);
+
+/**
+ @brief get the next calendar event, in date order.
+
+ Events of a same day come in event type order.
+
+ @param it pointer to the iterator state.
+ @param event return the event.
+ @return 1 if an event was returned, 0 at the end of the range.
+*/
+int
+hdate_event_iter_next (hdate_event_iter *it, hdate_event *event);
+
 /**
  @brief size of hebrew year in days.
  
@@ -335,6 +590,18 @@ hdate_get_size_of_hebrew_year (int hebrew_year);
 int
 hdate_days_from_3744 (int hebrew_year);
 
+/**
+ @brief Julian days of 1 Tishrey of a Hebrew year and of the next one
+ 
+ Both new years come out of a single molad evaluation.
+ 
+ @param hebrew_year The Hebrew year
+ @param jd_tishrey1 return the julian number of 1 Tishrey this year
+ @param jd_tishrey1_next_year return the julian number of 1 Tishrey next year
+*/
+void
+hdate_get_jd_tishrey1 (int hebrew_year, int *jd_tishrey1, int *jd_tishrey1_next_year);
+
 /**
  @brief Return Hebrew year type based on size and first week day of year.
  
@@ -345,6 +612,19 @@ hdate_days_from_3744 (int hebrew_year);
 int
 hdate_get_year_type (int size_of_year, int new_year_dw);
 
+/**
+ @brief Get the descriptor of a Hebrew year
+ 
+ Descriptors are kept in a small cache keyed by year, so repeated
+ conversions in the same year do not redo the molad arithmetic.
+ 
+ @param hebrew_year The Hebrew year
+ @param info return the year descriptor
+ @return pointer to info
+*/
+hdate_year_info *
+hdate_get_year_info (int hebrew_year, hdate_year_info *info);
+
 /**
  @brief Compute Julian day from Gregorian date
 
@@ -373,6 +653,16 @@ hdate_gdate_to_jd (int day, int month, int year);
 int
 hdate_hdate_to_jd (int day, int month, int year, int *jd_tishrey1, int *jd_tishrey1_next_year);
 
+/**
+ @brief Compute Julian days from an array of Hebrew dates
+ 
+ @param dates Hebrew dates to convert
+ @param count Number of dates
+ @param jd return count julian day numbers
+*/
+void
+hdate_hdate_to_jd_bulk (hdate_date const dates[], int count, int jd[]);
+
 /**
  @brief Converting from the Julian day to the Gregorian date
  
@@ -401,6 +691,19 @@ hdate_jd_to_gdate (int jd, int *day, int *month, int *year);
 void
 hdate_jd_to_hdate (int jd, int *day, int *month, int *year, int *jd_tishrey1, int *jd_tishrey1_next_year);
 
+/**
+ @brief Converting a span of Julian days to Hebrew dates
+ 
+ The year is resolved once, then days, months and years are stepped
+ incrementally.
+ 
+ @param jd_start Julian day of the first date
+ @param count Number of consecutive days to convert
+ @param out return count Hebrew dates
+*/
+void
+hdate_jd_range_to_hdate (int jd_start, int count, hdate_date out[]);
+
 /*************************************************************/
 /*************************************************************/
 
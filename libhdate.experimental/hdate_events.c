@@ -0,0 +1,330 @@
+/*  libhdate - Hebrew calendar library: http://libhdate.sourceforge.net
+ *
+ *  Copyright (C) 2011-2012 Boruch Baum  <boruch-baum@users.sourceforge.net>
+ *                2004-2007 Yaacov Zamir <kzamir@walla.co.il>
+ *                1984-2003 Amos Shapir
+ *  
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+
+#include "hdate.h"
+#include "support.h"
+
+/* All holyday types but the regular day */
+#define ALL_HOLYDAY_TYPES 0x3fe
+
+/**
+ @brief Return the julian day of the shabat on or before a day
+
+ @param jd the julian day.
+ @return the julian day of the shabat.
+*/
+static int
+hdate_get_shabbat_before (int jd)
+{
+	/* (jd + 1) % 7 + 1 is 7 on shabat */
+	return jd - (jd + 2) % 7;
+}
+
+/**
+ @brief Return the next holyday on or after a day
+
+ @param it pointer to the iterator state.
+ @param jd the julian day to search from.
+ @param value return the holyday number.
+ @return the julian day of the holyday, after last_jd if none
+*/
+static int
+hdate_next_holyday_event (hdate_event_iter const *it, int jd, int *value)
+{
+	jd = hdate_next_holyday (jd, it->diaspora, ALL_HOLYDAY_TYPES, value);
+	
+	return jd ? jd : it->last_jd + 1;
+}
+
+/**
+ @brief Return the next parasha reading on or after a day
+
+ Readings are on shabat, or on Simhat tora.
+
+ @param it pointer to the iterator state.
+ @param jd the julian day to search from.
+ @param value return the parasha number.
+ @return the julian day of the reading, after last_jd if none
+*/
+static int
+hdate_next_parasha_event (hdate_event_iter *it, int jd, int *value)
+{
+	hdate_struct h;
+	int day, month, year;
+	int shabbat;
+	
+	/* Simhat tora, 22 tishrey, or 23 in diaspora, this year or next */
+	if (it->simchat_tora_jd < jd)
+	{
+		hdate_jd_to_hdate (jd, &day, &month, &year, NULL, NULL);
+		for (; ; year++)
+		{
+			it->simchat_tora_jd = hdate_hdate_to_jd (22, 1, year, NULL, NULL);
+			if (it->simchat_tora_jd >= jd)
+				break;
+			if (it->diaspora && it->simchat_tora_jd + 1 >= jd)
+			{
+				it->simchat_tora_jd++;
+				break;
+			}
+		}
+	}
+	
+	/* Shabat with a reading, at most three holyday shabats in a row */
+	for (shabbat = hdate_get_shabbat_before (jd + 6); shabbat < it->simchat_tora_jd; shabbat += 7)
+	{
+		if (shabbat > it->last_jd)
+			return shabbat;
+		
+		*value = hdate_get_parasha (hdate_set_jd (&h, shabbat), it->diaspora);
+		if (*value)
+			return shabbat;
+	}
+	
+	*value = 54;
+	
+	return it->simchat_tora_jd;
+}
+
+/**
+ @brief Return the next day in the omer on or after a day
+
+ @param it pointer to the iterator state.
+ @param jd the julian day to search from.
+ @param value return the day in the omer.
+ @return the julian day, after last_jd if none
+*/
+static int
+hdate_next_omer_event (hdate_event_iter const *it, int jd, int *value)
+{
+	hdate_struct h;
+	int second_of_pesach;
+	
+	/* the day after an omer day */
+	if (jd == it->next_jd[HDATE_EVENT_OMER] + 1 && it->next_value[HDATE_EVENT_OMER] < 49)
+	{
+		*value = it->next_value[HDATE_EVENT_OMER] + 1;
+		return jd;
+	}
+	
+	hdate_set_jd (&h, jd);
+	*value = hdate_get_omer_day (&h);
+	if (*value)
+		return jd;
+	
+	/* 16 nisan, this year or next */
+	second_of_pesach = hdate_hdate_to_jd (16, 7, h.hd_year, NULL, NULL);
+	if (second_of_pesach < jd)
+		second_of_pesach = hdate_hdate_to_jd (16, 7, h.hd_year + 1, NULL, NULL);
+	
+	*value = 1;
+	
+	return second_of_pesach;
+}
+
+/**
+ @brief Return the next Rosh chodesh day on or after a day
+
+ Rosh chodesh is the 30 of a month, and the 1 of the next one,
+ but for Rosh hashana.
+
+ @param it pointer to the iterator state.
+ @param jd the julian day to search from.
+ @param value return the number of the new month.
+ @return the julian day, after last_jd if none
+*/
+static int
+hdate_next_rosh_chodesh_event (hdate_event_iter const *it, int jd, int *value)
+{
+	hdate_struct h;
+	
+	hdate_set_jd (&h, jd);
+	
+	/* 30 of this month, or 1 of the next one if this month has 29 days */
+	if (h.hd_day != 30 && (h.hd_day != 1 || h.hd_mon == 1))
+	{
+		jd = jd + 30 - h.hd_day;
+		hdate_set_jd (&h, jd);
+		
+		/* 1 tishrey, on to the 30 */
+		if (h.hd_day == 1 && h.hd_mon == 1)
+		{
+			jd = jd + 29;
+			hdate_set_jd (&h, jd);
+		}
+	}
+	
+	/* the 30 belongs to the month it starts */
+	if (h.hd_day == 30)
+		hdate_next_day (&h);
+	*value = h.hd_mon;
+	
+	return jd > it->last_jd ? it->last_jd + 1 : jd;
+}
+
+/**
+ @brief Return the next special shabat on or after a day
+
+ @param it pointer to the iterator state.
+ @param jd the julian day to search from.
+ @param value return the special shabbat number (HDATE_SHABBAT_SHUVA etc.)
+ @return the julian day of the shabat, after last_jd if none
+*/
+static int
+hdate_next_special_shabbat_event (hdate_event_iter *it, int jd, int *value)
+{
+	int *shabbat = it->special_shabbat_jd;
+	int day, month, year;
+	int adar;
+	int i;
+	
+	/* the special shabbats of the year, and of the next one after nachamu */
+	if (shabbat[HDATE_SHABBAT_NACHAMU] < jd)
+	{
+		hdate_jd_to_hdate (jd, &day, &month, &year, NULL, NULL);
+		
+		for (; shabbat[HDATE_SHABBAT_NACHAMU] < jd; year++)
+		{
+			/* purim and the new month are in adar II on leap years */
+			adar = (hdate_get_size_of_hebrew_year (year) > 355) ? 14 : 6;
+			
+			shabbat[HDATE_SHABBAT_SHUVA] = hdate_get_shabbat_before (hdate_hdate_to_jd (9, 1, year, NULL, NULL));
+			shabbat[HDATE_SHABBAT_SHEKALIM] = hdate_get_shabbat_before (hdate_hdate_to_jd (1, adar, year, NULL, NULL));
+			shabbat[HDATE_SHABBAT_ZACHOR] = hdate_get_shabbat_before (hdate_hdate_to_jd (13, adar, year, NULL, NULL));
+			shabbat[HDATE_SHABBAT_HACHODESH] = hdate_get_shabbat_before (hdate_hdate_to_jd (1, 7, year, NULL, NULL));
+			shabbat[HDATE_SHABBAT_PARAH] = shabbat[HDATE_SHABBAT_HACHODESH] - 7;
+			shabbat[HDATE_SHABBAT_HAGADOL] = hdate_get_shabbat_before (hdate_hdate_to_jd (14, 7, year, NULL, NULL));
+			shabbat[HDATE_SHABBAT_CHAZON] = hdate_get_shabbat_before (hdate_hdate_to_jd (9, 11, year, NULL, NULL));
+			shabbat[HDATE_SHABBAT_NACHAMU] = shabbat[HDATE_SHABBAT_CHAZON] + 7;
+		}
+	}
+	
+	/* the numbers are in date order */
+	for (i = HDATE_SHABBAT_SHUVA; shabbat[i] < jd; i++)
+		;
+	
+	*value = i;
+	
+	return shabbat[i] > it->last_jd ? it->last_jd + 1 : shabbat[i];
+}
+
+/**
+ @brief Look up the next event of a type on or after a day
+
+ @param it pointer to the iterator state.
+ @param type the event type.
+ @param jd the julian day to search from.
+*/
+static void
+hdate_event_iter_find (hdate_event_iter *it, int type, int jd)
+{
+	int *value = &it->next_value[type];
+	
+	if (!(it->type_mask & (1 << type)) || jd > it->last_jd)
+	{
+		it->next_jd[type] = it->last_jd + 1;
+		return;
+	}
+	
+	switch (type)
+	{
+	case HDATE_EVENT_HOLYDAY:
+		it->next_jd[type] = hdate_next_holyday_event (it, jd, value);
+		break;
+	case HDATE_EVENT_PARASHA:
+		it->next_jd[type] = hdate_next_parasha_event (it, jd, value);
+		break;
+	case HDATE_EVENT_OMER:
+		it->next_jd[type] = hdate_next_omer_event (it, jd, value);
+		break;
+	case HDATE_EVENT_ROSH_CHODESH:
+		it->next_jd[type] = hdate_next_rosh_chodesh_event (it, jd, value);
+		break;
+	default:
+		it->next_jd[type] = hdate_next_special_shabbat_event (it, jd, value);
+		break;
+	}
+	
+	return;
+}
+
+/**
+ @brief start iterating over the calendar events of a range of days.
+
+ @param it pointer to the iterator state.
+ @param first_jd the first julian day of the range.
+ @param last_jd the last julian day of the range.
+ @param diaspora if true give diaspora holidays and readings
+ @param type_mask event types to give, bit 1 << type for each type
+   (HDATE_EVENT_HOLYDAY etc.)
+*/
+void
+hdate_event_iter_init (hdate_event_iter *it, int first_jd, int last_jd, int diaspora, int type_mask)
+{
+	int type;
+	
+	it->last_jd = last_jd;
+	it->diaspora = diaspora;
+	it->type_mask = type_mask;
+	/* no omer day before the range to count on from */
+	it->next_jd[HDATE_EVENT_OMER] = 0;
+	it->next_value[HDATE_EVENT_OMER] = 49;
+	it->simchat_tora_jd = 0;
+	it->special_shabbat_jd[HDATE_SHABBAT_NACHAMU] = 0;
+	
+	for (type = 0; type < HDATE_EVENT_TYPES; type++)
+		hdate_event_iter_find (it, type, first_jd);
+	
+	return;
+}
+
+/**
+ @brief get the next calendar event, in date order.
+
+ Each event type keeps its next day, only the type just given is
+ looked up again, from the day after.
+
+ @param it pointer to the iterator state.
+ @param event return the event.
+ @return 1 if an event was returned, 0 at the end of the range.
+*/
+int
+hdate_event_iter_next (hdate_event_iter *it, hdate_event *event)
+{
+	int type;
+	int next = 0;
+	
+	for (type = 1; type < HDATE_EVENT_TYPES; type++)
+		if (it->next_jd[type] < it->next_jd[next])
+			next = type;
+	
+	if (it->next_jd[next] > it->last_jd)
+		return 0;
+	
+	event->jd = it->next_jd[next];
+	event->type = next;
+	event->value = it->next_value[next];
+	
+	hdate_event_iter_find (it, next, event->jd + 1);
+	
+	return 1;
+}
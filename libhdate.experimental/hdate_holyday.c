@@ -18,23 +18,29 @@
  *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
  
+#include <stdlib.h>
+
 #include "hdate.h"
 #include "support.h"
 
+#ifndef HDATE_NO_HOLYDAY_TABLE
+#include "hdate_holyday_table.h"
+#endif
+
 /**
- @brief Return number of hebrew holyday.
+ @brief Return number of hebrew holyday, from the holyday rules.
 
  @param h The hdate_struct of the date to use.
  @param diaspora if True give diaspora holydays
  @return the number of holyday.
 */
-int
-hdate_get_holyday (hdate_struct const * h, int diaspora)
+static int
+hdate_get_holyday_by_rules (hdate_struct const * h, int diaspora)
 {
 	int holyday;
 
-	/* holydays table */
-	static int holydays_table[14][30] = 
+	/* holydays table, the holydays 1..37 fit in a byte */
+	static const unsigned char holydays_table[14][30] =
 	{
 		{	/* Tishrey */
 			1, 2, 3, 3, 0, 0, 0, 0, 37, 4,
@@ -240,6 +246,215 @@ hdate_get_holyday (hdate_struct const * h, int diaspora)
 	return holyday;
 }
 
+#ifndef HDATE_NO_HOLYDAY_TABLE
+/**
+ @brief Number of the table list of a year type
+
+ @param year_type The number type of year 1..14
+ @param diaspora if True give diaspora holydays
+ @return the list number, -1 if the year type is not valid
+*/
+static int
+hdate_get_holyday_list (int year_type, int diaspora)
+{
+	if (year_type < 1 || year_type > 14)
+		return -1;
+	
+	return (diaspora ? 14 : 0) + year_type - 1;
+}
+
+/**
+ @brief Number of bits set
+
+ @param bits the bits to count
+ @return the number of bits set
+*/
+static int
+hdate_count_bits (unsigned int bits)
+{
+	bits = bits - ((bits >> 1) & 0x55555555);
+	bits = (bits & 0x33333333) + ((bits >> 2) & 0x33333333);
+	bits = (bits + (bits >> 4)) & 0x0f0f0f0f;
+	
+	return (bits * 0x01010101) >> 24;
+}
+
+/**
+ @brief Place in hdate_holyday_table of the first event of a list on or after a day
+
+ @param list The table list, see hdate_get_holyday_list
+ @param days Days since 1 tishrey, 1 for 1 tishrey
+ @return the index of the event in hdate_holyday_table
+*/
+static int
+hdate_get_holyday_table_event (int list, int days)
+{
+	unsigned int day_bit = 1u << (days & 31);
+	
+	return hdate_holyday_table_index[list] + hdate_holyday_table_rank[list][days >> 5]
+		+ hdate_count_bits (hdate_holyday_table_days[list][days >> 5] & (day_bit - 1));
+}
+#endif
+
+/**
+ @brief Return number of hebrew holyday.
+
+ From HDATE_HOLYDAY_TABLE_FIRST_YEAR on, the year's holydays only depend
+ on the year type, and are looked up in the generated table: the days
+ bitmap tells if the day is a holyday, and counting its bits before the
+ day gives the holyday's place in the year's list.
+
+ @param h The hdate_struct of the date to use.
+ @param diaspora if True give diaspora holydays
+ @return the number of holyday.
+*/
+int
+hdate_get_holyday (hdate_struct const * h, int diaspora)
+{
+#ifndef HDATE_NO_HOLYDAY_TABLE
+	int list;
+	
+	if (h->hd_year >= HDATE_HOLYDAY_TABLE_FIRST_YEAR &&
+		(list = hdate_get_holyday_list (h->hd_year_type, diaspora)) >= 0)
+	{
+		if (h->hd_days < 1 || h->hd_days > h->hd_size_of_year ||
+			!(hdate_holyday_table_days[list][h->hd_days >> 5] & (1u << (h->hd_days & 31))))
+			return 0;
+		
+		return hdate_holyday_table[hdate_get_holyday_table_event (list, h->hd_days)] & 0x3f;
+	}
+#endif
+	
+	return hdate_get_holyday_by_rules (h, diaspora);
+}
+
+/**
+ @brief get the holidays of a hebrew year, in date order.
+
+ @param hebrew_year the hebrew year.
+ @param diaspora if true give diaspora holidays
+ @param events return the holidays of the year
+ @param max_events size of events
+ @return the number of holidays written to events.
+*/
+int
+hdate_get_holyday_events (int hebrew_year, int diaspora, hdate_holyday_event events[], int max_events)
+{
+	hdate_year_info info;
+	hdate_struct h;
+	int count = 0;
+	int days;
+	int holyday;
+#ifndef HDATE_NO_HOLYDAY_TABLE
+	int list;
+	int event;
+#endif
+	
+	hdate_get_year_info (hebrew_year, &info);
+	
+#ifndef HDATE_NO_HOLYDAY_TABLE
+	if (hebrew_year >= HDATE_HOLYDAY_TABLE_FIRST_YEAR &&
+		(list = hdate_get_holyday_list (info.year_type, diaspora)) >= 0)
+	{
+		for (event = hdate_holyday_table_index[list];
+			event < hdate_holyday_table_index[list + 1] && count < max_events; event++, count++)
+		{
+			events[count].days = hdate_holyday_table[event] >> 6;
+			events[count].holyday = hdate_holyday_table[event] & 0x3f;
+		}
+		
+		return count;
+	}
+#endif
+	
+	for (days = 1; days <= info.size_of_year && count < max_events; days++)
+	{
+		hdate_set_jd (&h, info.jd_tishrey1 + days - 1);
+		holyday = hdate_get_holyday_by_rules (&h, diaspora);
+		
+		if (holyday)
+		{
+			events[count].days = days;
+			events[count].holyday = holyday;
+			count++;
+		}
+	}
+	
+	return count;
+}
+
+/**
+ @brief Return the next holyday of some holyday types.
+
+ Years from HDATE_HOLYDAY_TABLE_FIRST_YEAR on jump straight to the day's
+ place in the year type's list; earlier years step the days through
+ the rules.
+
+ @param jd the julian day to search from, a holyday on jd is returned
+ @param diaspora if true give diaspora holidays
+ @param type_mask holyday types to look for, bit 1 << type for each type
+   (see hdate_get_holyday_type)
+ @param holyday return the number of holyday, 0 if none was found
+ @return the julian day of the holyday, 0 if none was found in
+   HDATE_NEXT_HOLYDAY_YEARS years
+*/
+int
+hdate_next_holyday (int jd, int diaspora, int type_mask, int *holyday)
+{
+	hdate_year_info info;
+	hdate_struct h;
+	int day, month, year;
+	int days;
+	int years;
+#ifndef HDATE_NO_HOLYDAY_TABLE
+	int list;
+	int event;
+	int last_event;
+#endif
+	
+	hdate_jd_to_hdate (jd, &day, &month, &year, NULL, NULL);
+	hdate_get_year_info (year, &info);
+	days = jd - info.jd_tishrey1 + 1;
+	
+	for (years = 0; years < HDATE_NEXT_HOLYDAY_YEARS; years++)
+	{
+#ifndef HDATE_NO_HOLYDAY_TABLE
+		if (info.year >= HDATE_HOLYDAY_TABLE_FIRST_YEAR &&
+			(list = hdate_get_holyday_list (info.year_type, diaspora)) >= 0)
+		{
+			last_event = hdate_holyday_table_index[list + 1];
+			for (event = hdate_get_holyday_table_event (list, days); event < last_event; event++)
+			{
+				if (type_mask & (1 << hdate_get_holyday_type (hdate_holyday_table[event] & 0x3f)))
+				{
+					*holyday = hdate_holyday_table[event] & 0x3f;
+					return info.jd_tishrey1 + (hdate_holyday_table[event] >> 6) - 1;
+				}
+			}
+		}
+		else
+#endif
+		{
+			/* step the days left in the year through the rules */
+			hdate_set_jd (&h, info.jd_tishrey1 + days - 1);
+			for (; h.hd_year == info.year; hdate_next_day (&h))
+			{
+				*holyday = hdate_get_holyday_by_rules (&h, diaspora);
+				if (*holyday && (type_mask & (1 << hdate_get_holyday_type (*holyday))))
+					return h.hd_jd;
+			}
+		}
+		
+		/* on to 1 tishrey of next year */
+		hdate_get_year_info (info.year + 1, &info);
+		days = 1;
+	}
+	
+	*holyday = 0;
+	
+	return 0;
+}
+
 /**
  @brief Return the day in the omer of the given date
 
@@ -250,10 +465,11 @@ int
 hdate_get_omer_day(hdate_struct const * h)
 {
 	int omer_day;
-	hdate_struct sixteen_nissan;
+	hdate_year_info info;
 	
-	hdate_set_hdate(&sixteen_nissan, 16, 7, h->hd_year);
-	omer_day = h->hd_jd - sixteen_nissan.hd_jd + 1;
+	/* nissan to elul allways have 177 days, 16 nissan is 162 days before next new year */
+	hdate_get_year_info (h->hd_year, &info);
+	omer_day = h->hd_jd - (info.jd_tishrey1 + info.size_of_year - 162) + 1;
 
 	if ((omer_day > 49) || (omer_day < 0)) 
 		omer_day = 0;
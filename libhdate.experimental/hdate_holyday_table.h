@@ -0,0 +1,288 @@
+/* Generated by tools/gen_holyday_table.c, do not edit */
+
+/* Holydays of years from 5765 on, one list per [diaspora][year_type - 1]
+   in date order: (days since 1 tishrey, 1 based) << 6 | holyday */
+#define HDATE_HOLYDAY_TABLE_FIRST_YEAR 5765
+
+static const unsigned short hdate_holyday_table[] = {
+	/* israel, year type 1 (5773) */
+	0x0041, 0x0082, 0x00c3, 0x0265, 0x0284, 0x03c5, 0x0406, 0x0446,
+	0x0486, 0x04c6, 0x0506, 0x0547, 0x059b, 0x0aa3, 0x1509, 0x1549,
+	0x1589, 0x15c9, 0x1609, 0x1649, 0x1689, 0x16c9, 0x188a, 0x210b,
+	0x24e1, 0x278c, 0x284d, 0x288e, 0x2fcf, 0x3010, 0x3050, 0x3090,
+	0x30d0, 0x3110, 0x315c, 0x3318, 0x34d9, 0x3511, 0x3812, 0x3a9a,
+	0x3c13, 0x3c54, 0x4695, 0x49a4, 0x4bd6, 0x4d57,
+	/* israel, year type 2 (5781) */
+	0x0041, 0x0082, 0x00c3, 0x0265, 0x0284, 0x03c5, 0x0406, 0x0446,
+	0x0486, 0x04c6, 0x0506, 0x0547, 0x059b, 0x0a63, 0x1509, 0x1549,
+	0x1589, 0x15c9, 0x1609, 0x1649, 0x1689, 0x16c9, 0x188a, 0x210b,
+	0x24e1, 0x280c, 0x284d, 0x288e, 0x2fcf, 0x3010, 0x3050, 0x3090,
+	0x30d0, 0x3110, 0x315c, 0x3298, 0x3419, 0x3451, 0x3812, 0x3a9a,
+	0x3c13, 0x3c54, 0x4695, 0x49a4, 0x4bd6, 0x4d57,
+	/* israel, year type 3 (5766) */
+	0x0041, 0x0082, 0x00c3, 0x0265, 0x0284, 0x03c5, 0x0406, 0x0446,
+	0x0486, 0x04c6, 0x0506, 0x0547, 0x059b, 0x0aa3, 0x1509, 0x1549,
+	0x1589, 0x15c9, 0x1609, 0x1649, 0x1689, 0x16c9, 0x18ca, 0x214b,
+	0x2521, 0x284c, 0x288d, 0x28ce, 0x300f, 0x3050, 0x3090, 0x30d0,
+	0x3110, 0x3150, 0x319c, 0x3318, 0x34d9, 0x3511, 0x3852, 0x3ada,
+	0x3c53, 0x3c94, 0x46d5, 0x49e4, 0x4c16, 0x4d97,
+	/* israel, year type 4 (5772) */
+	0x0041, 0x0082, 0x0103, 0x0265, 0x0284, 0x03c5, 0x0406, 0x0446,
+	0x0486, 0x04c6, 0x0506, 0x0547, 0x059b, 0x0aa3, 0x1509, 0x1549,
+	0x1589, 0x15c9, 0x1609, 0x1649, 0x1689, 0x16c9, 0x18ca, 0x214b,
+	0x2521, 0x284c, 0x288d, 0x28ce, 0x300f, 0x3050, 0x3090, 0x30d0,
+	0x3110, 0x3150, 0x319c, 0x3318, 0x3499, 0x34d1, 0x3852, 0x3ada,
+	0x3c53, 0x3c94, 0x4715, 0x49e4, 0x4c56, 0x4d97,
+	/* israel, year type 5 (5780) */
+	0x0041, 0x0082, 0x00c3, 0x0265, 0x0284, 0x03c5, 0x0406, 0x0446,
+	0x0486, 0x04c6, 0x0506, 0x0547, 0x059b, 0x0aa3, 0x1549, 0x1589,
+	0x15c9, 0x1609, 0x1649, 0x1689, 0x16c9, 0x1709, 0x190a, 0x218b,
+	0x2561, 0x288c, 0x28cd, 0x290e, 0x304f, 0x3090, 0x30d0, 0x3110,
+	0x3150, 0x3190, 0x31dc, 0x3358, 0x3519, 0x3551, 0x3892, 0x3b1a,
+	0x3c93, 0x3cd4, 0x4715, 0x4a24, 0x4c56, 0x4dd7,
+	/* israel, year type 6 (5785) */
+	0x0041, 0x0082, 0x0103, 0x0265, 0x0284, 0x03c5, 0x0406, 0x0446,
+	0x0486, 0x04c6, 0x0506, 0x0547, 0x059b, 0x0aa3, 0x1549, 0x1589,
+	0x15c9, 0x1609, 0x1649, 0x1689, 0x16c9, 0x1709, 0x190a, 0x218b,
+	0x2561, 0x288c, 0x28cd, 0x290e, 0x304f, 0x3090, 0x30d0, 0x3110,
+	0x3150, 0x3190, 0x31dc, 0x3318, 0x3499, 0x34d1, 0x3892, 0x3b1a,
+	0x3c93, 0x3cd4, 0x4715, 0x4a24, 0x4c56, 0x4dd7,
+	/* israel, year type 7 (5767) */
+	0x0041, 0x0082, 0x00c3, 0x0265, 0x0284, 0x03c5, 0x0406, 0x0446,
+	0x0486, 0x04c6, 0x0506, 0x0547, 0x059b, 0x0a63, 0x1549, 0x1589,
+	0x15c9, 0x1609, 0x1649, 0x1689, 0x16c9, 0x1709, 0x190a, 0x218b,
+	0x2561, 0x280c, 0x28cd, 0x290e, 0x304f, 0x3090, 0x30d0, 0x3110,
+	0x3150, 0x3190, 0x31dc, 0x3398, 0x3559, 0x3591, 0x3892, 0x3b1a,
+	0x3c93, 0x3cd4, 0x4715, 0x4a24, 0x4c56, 0x4dd7,
+	/* israel, year type 8 (5790) */
+	0x0041, 0x0082, 0x00c3, 0x0265, 0x0284, 0x03c5, 0x0406, 0x0446,
+	0x0486, 0x04c6, 0x0506, 0x0547, 0x059b, 0x0aa3, 0x1509, 0x1549,
+	0x1589, 0x15c9, 0x1609, 0x1649, 0x1689, 0x16c9, 0x188a, 0x210b,
+	0x24e1, 0x2f8c, 0x2fcd, 0x300e, 0x374f, 0x3790, 0x37d0, 0x3810,
+	0x3850, 0x3890, 0x38dc, 0x3a58, 0x3c19, 0x3c51, 0x3f92, 0x421a,
+	0x4393, 0x43d4, 0x4e15, 0x5124, 0x5356, 0x54d7,
+	/* israel, year type 9 (5765) */
+	0x0041, 0x0082, 0x0103, 0x0265, 0x0284, 0x03c5, 0x0406, 0x0446,
+	0x0486, 0x04c6, 0x0506, 0x0547, 0x059b, 0x0aa3, 0x1509, 0x1549,
+	0x1589, 0x15c9, 0x1609, 0x1649, 0x1689, 0x16c9, 0x188a, 0x210b,
+	0x24e1, 0x2f8c, 0x2fcd, 0x300e, 0x374f, 0x3790, 0x37d0, 0x3810,
+	0x3850, 0x3890, 0x38dc, 0x3a18, 0x3b99, 0x3bd1, 0x3f92, 0x421a,
+	0x4393, 0x43d4, 0x4e15, 0x5124, 0x5356, 0x54d7,
+	/* israel, year type 10 (5784) */
+	0x0041, 0x0082, 0x00c3, 0x0265, 0x0284, 0x03c5, 0x0406, 0x0446,
+	0x0486, 0x04c6, 0x0506, 0x0547, 0x059b, 0x0a63, 0x1509, 0x1549,
+	0x1589, 0x15c9, 0x1609, 0x1649, 0x1689, 0x16c9, 0x188a, 0x210b,
+	0x24e1, 0x2f0c, 0x2fcd, 0x300e, 0x374f, 0x3790, 0x37d0, 0x3810,
+	0x3850, 0x3890, 0x38dc, 0x3a98, 0x3c59, 0x3c91, 0x3f92, 0x421a,
+	0x4393, 0x43d4, 0x4e15, 0x5124, 0x5356, 0x54d7,
+	/* israel, year type 11 (5782) */
+	0x0041, 0x0082, 0x00c3, 0x0265, 0x0284, 0x03c5, 0x0406, 0x0446,
+	0x0486, 0x04c6, 0x0506, 0x0547, 0x059b, 0x0aa3, 0x1509, 0x1549,
+	0x1589, 0x15c9, 0x1609, 0x1649, 0x1689, 0x16c9, 0x18ca, 0x214b,
+	0x2521, 0x2fcc, 0x300d, 0x304e, 0x378f, 0x37d0, 0x3810, 0x3850,
+	0x3890, 0x38d0, 0x391c, 0x3a98, 0x3c19, 0x3c51, 0x3fd2, 0x425a,
+	0x43d3, 0x4414, 0x4e95, 0x5164, 0x53d6, 0x5517,
+	/* israel, year type 12 (5776) */
+	0x0041, 0x0082, 0x00c3, 0x0265, 0x0284, 0x03c5, 0x0406, 0x0446,
+	0x0486, 0x04c6, 0x0506, 0x0547, 0x059b, 0x0aa3, 0x1549, 0x1589,
+	0x15c9, 0x1609, 0x1649, 0x1689, 0x16c9, 0x1709, 0x190a, 0x218b,
+	0x2561, 0x300c, 0x304d, 0x308e, 0x37cf, 0x3810, 0x3850, 0x3890,
+	0x38d0, 0x3910, 0x395c, 0x3ad8, 0x3c59, 0x3c91, 0x4012, 0x429a,
+	0x4413, 0x4454, 0x4ed5, 0x51a4, 0x5416, 0x5557,
+	/* israel, year type 13 (5771) */
+	0x0041, 0x0082, 0x0103, 0x0265, 0x0284, 0x03c5, 0x0406, 0x0446,
+	0x0486, 0x04c6, 0x0506, 0x0547, 0x059b, 0x0aa3, 0x1549, 0x1589,
+	0x15c9, 0x1609, 0x1649, 0x1689, 0x16c9, 0x1709, 0x190a, 0x218b,
+	0x2561, 0x2f8c, 0x304d, 0x308e, 0x37cf, 0x3810, 0x3850, 0x3890,
+	0x38d0, 0x3910, 0x395c, 0x3b18, 0x3cd9, 0x3d11, 0x4012, 0x429a,
+	0x4413, 0x4454, 0x4e95, 0x51a4, 0x53d6, 0x5557,
+	/* israel, year type 14 (5787) */
+	0x0041, 0x0082, 0x00c3, 0x0265, 0x0284, 0x03c5, 0x0406, 0x0446,
+	0x0486, 0x04c6, 0x0506, 0x0547, 0x059b, 0x0a63, 0x1549, 0x1589,
+	0x15c9, 0x1609, 0x1649, 0x1689, 0x16c9, 0x1709, 0x190a, 0x218b,
+	0x2561, 0x300c, 0x304d, 0x308e, 0x37cf, 0x3810, 0x3850, 0x3890,
+	0x38d0, 0x3910, 0x395c, 0x3ad8, 0x3c99, 0x3cd1, 0x4012, 0x429a,
+	0x4413, 0x4454, 0x4e95, 0x51a4, 0x53d6, 0x5557,
+	/* diaspora, year type 1 (5773) */
+	0x0041, 0x0082, 0x00c3, 0x0265, 0x0284, 0x03c5, 0x041f, 0x0446,
+	0x0486, 0x04c6, 0x0506, 0x0547, 0x059b, 0x05c8, 0x0aa3, 0x1509,
+	0x1549, 0x1589, 0x15c9, 0x1609, 0x1649, 0x1689, 0x16c9, 0x188a,
+	0x210b, 0x24e1, 0x278c, 0x284d, 0x288e, 0x2fcf, 0x3020, 0x3050,
+	0x3090, 0x30d0, 0x3110, 0x315c, 0x319d, 0x3318, 0x34d9, 0x3511,
+	0x3812, 0x3a9a, 0x3c13, 0x3c54, 0x3c9e, 0x4695, 0x49a4, 0x4bd6,
+	0x4d57,
+	/* diaspora, year type 2 (5781) */
+	0x0041, 0x0082, 0x00c3, 0x0265, 0x0284, 0x03c5, 0x041f, 0x0446,
+	0x0486, 0x04c6, 0x0506, 0x0547, 0x059b, 0x05c8, 0x0a63, 0x1509,
+	0x1549, 0x1589, 0x15c9, 0x1609, 0x1649, 0x1689, 0x16c9, 0x188a,
+	0x210b, 0x24e1, 0x280c, 0x284d, 0x288e, 0x2fcf, 0x3020, 0x3050,
+	0x3090, 0x30d0, 0x3110, 0x315c, 0x319d, 0x3298, 0x3419, 0x3451,
+	0x3812, 0x3a9a, 0x3c13, 0x3c54, 0x3c9e, 0x4695, 0x49a4, 0x4bd6,
+	0x4d57,
+	/* diaspora, year type 3 (5766) */
+	0x0041, 0x0082, 0x00c3, 0x0265, 0x0284, 0x03c5, 0x041f, 0x0446,
+	0x0486, 0x04c6, 0x0506, 0x0547, 0x059b, 0x05c8, 0x0aa3, 0x1509,
+	0x1549, 0x1589, 0x15c9, 0x1609, 0x1649, 0x1689, 0x16c9, 0x18ca,
+	0x214b, 0x2521, 0x284c, 0x288d, 0x28ce, 0x300f, 0x3060, 0x3090,
+	0x30d0, 0x3110, 0x3150, 0x319c, 0x31dd, 0x3318, 0x34d9, 0x3511,
+	0x3852, 0x3ada, 0x3c53, 0x3c94, 0x3cde, 0x46d5, 0x49e4, 0x4c16,
+	0x4d97,
+	/* diaspora, year type 4 (5772) */
+	0x0041, 0x0082, 0x0103, 0x0265, 0x0284, 0x03c5, 0x041f, 0x0446,
+	0x0486, 0x04c6, 0x0506, 0x0547, 0x059b, 0x05c8, 0x0aa3, 0x1509,
+	0x1549, 0x1589, 0x15c9, 0x1609, 0x1649, 0x1689, 0x16c9, 0x18ca,
+	0x214b, 0x2521, 0x284c, 0x288d, 0x28ce, 0x300f, 0x3060, 0x3090,
+	0x30d0, 0x3110, 0x3150, 0x319c, 0x31dd, 0x3318, 0x3499, 0x34d1,
+	0x3852, 0x3ada, 0x3c53, 0x3c94, 0x3cde, 0x4715, 0x49e4, 0x4c56,
+	0x4d97,
+	/* diaspora, year type 5 (5780) */
+	0x0041, 0x0082, 0x00c3, 0x0265, 0x0284, 0x03c5, 0x041f, 0x0446,
+	0x0486, 0x04c6, 0x0506, 0x0547, 0x059b, 0x05c8, 0x0aa3, 0x1549,
+	0x1589, 0x15c9, 0x1609, 0x1649, 0x1689, 0x16c9, 0x1709, 0x190a,
+	0x218b, 0x2561, 0x288c, 0x28cd, 0x290e, 0x304f, 0x30a0, 0x30d0,
+	0x3110, 0x3150, 0x3190, 0x31dc, 0x321d, 0x3358, 0x3519, 0x3551,
+	0x3892, 0x3b1a, 0x3c93, 0x3cd4, 0x3d1e, 0x4715, 0x4a24, 0x4c56,
+	0x4dd7,
+	/* diaspora, year type 6 (5785) */
+	0x0041, 0x0082, 0x0103, 0x0265, 0x0284, 0x03c5, 0x041f, 0x0446,
+	0x0486, 0x04c6, 0x0506, 0x0547, 0x059b, 0x05c8, 0x0aa3, 0x1549,
+	0x1589, 0x15c9, 0x1609, 0x1649, 0x1689, 0x16c9, 0x1709, 0x190a,
+	0x218b, 0x2561, 0x288c, 0x28cd, 0x290e, 0x304f, 0x30a0, 0x30d0,
+	0x3110, 0x3150, 0x3190, 0x31dc, 0x321d, 0x3318, 0x3499, 0x34d1,
+	0x3892, 0x3b1a, 0x3c93, 0x3cd4, 0x3d1e, 0x4715, 0x4a24, 0x4c56,
+	0x4dd7,
+	/* diaspora, year type 7 (5767) */
+	0x0041, 0x0082, 0x00c3, 0x0265, 0x0284, 0x03c5, 0x041f, 0x0446,
+	0x0486, 0x04c6, 0x0506, 0x0547, 0x059b, 0x05c8, 0x0a63, 0x1549,
+	0x1589, 0x15c9, 0x1609, 0x1649, 0x1689, 0x16c9, 0x1709, 0x190a,
+	0x218b, 0x2561, 0x280c, 0x28cd, 0x290e, 0x304f, 0x30a0, 0x30d0,
+	0x3110, 0x3150, 0x3190, 0x31dc, 0x321d, 0x3398, 0x3559, 0x3591,
+	0x3892, 0x3b1a, 0x3c93, 0x3cd4, 0x3d1e, 0x4715, 0x4a24, 0x4c56,
+	0x4dd7,
+	/* diaspora, year type 8 (5790) */
+	0x0041, 0x0082, 0x00c3, 0x0265, 0x0284, 0x03c5, 0x041f, 0x0446,
+	0x0486, 0x04c6, 0x0506, 0x0547, 0x059b, 0x05c8, 0x0aa3, 0x1509,
+	0x1549, 0x1589, 0x15c9, 0x1609, 0x1649, 0x1689, 0x16c9, 0x188a,
+	0x210b, 0x24e1, 0x2f8c, 0x2fcd, 0x300e, 0x374f, 0x37a0, 0x37d0,
+	0x3810, 0x3850, 0x3890, 0x38dc, 0x391d, 0x3a58, 0x3c19, 0x3c51,
+	0x3f92, 0x421a, 0x4393, 0x43d4, 0x441e, 0x4e15, 0x5124, 0x5356,
+	0x54d7,
+	/* diaspora, year type 9 (5765) */
+	0x0041, 0x0082, 0x0103, 0x0265, 0x0284, 0x03c5, 0x041f, 0x0446,
+	0x0486, 0x04c6, 0x0506, 0x0547, 0x059b, 0x05c8, 0x0aa3, 0x1509,
+	0x1549, 0x1589, 0x15c9, 0x1609, 0x1649, 0x1689, 0x16c9, 0x188a,
+	0x210b, 0x24e1, 0x2f8c, 0x2fcd, 0x300e, 0x374f, 0x37a0, 0x37d0,
+	0x3810, 0x3850, 0x3890, 0x38dc, 0x391d, 0x3a18, 0x3b99, 0x3bd1,
+	0x3f92, 0x421a, 0x4393, 0x43d4, 0x441e, 0x4e15, 0x5124, 0x5356,
+	0x54d7,
+	/* diaspora, year type 10 (5784) */
+	0x0041, 0x0082, 0x00c3, 0x0265, 0x0284, 0x03c5, 0x041f, 0x0446,
+	0x0486, 0x04c6, 0x0506, 0x0547, 0x059b, 0x05c8, 0x0a63, 0x1509,
+	0x1549, 0x1589, 0x15c9, 0x1609, 0x1649, 0x1689, 0x16c9, 0x188a,
+	0x210b, 0x24e1, 0x2f0c, 0x2fcd, 0x300e, 0x374f, 0x37a0, 0x37d0,
+	0x3810, 0x3850, 0x3890, 0x38dc, 0x391d, 0x3a98, 0x3c59, 0x3c91,
+	0x3f92, 0x421a, 0x4393, 0x43d4, 0x441e, 0x4e15, 0x5124, 0x5356,
+	0x54d7,
+	/* diaspora, year type 11 (5782) */
+	0x0041, 0x0082, 0x00c3, 0x0265, 0x0284, 0x03c5, 0x041f, 0x0446,
+	0x0486, 0x04c6, 0x0506, 0x0547, 0x059b, 0x05c8, 0x0aa3, 0x1509,
+	0x1549, 0x1589, 0x15c9, 0x1609, 0x1649, 0x1689, 0x16c9, 0x18ca,
+	0x214b, 0x2521, 0x2fcc, 0x300d, 0x304e, 0x378f, 0x37e0, 0x3810,
+	0x3850, 0x3890, 0x38d0, 0x391c, 0x395d, 0x3a98, 0x3c19, 0x3c51,
+	0x3fd2, 0x425a, 0x43d3, 0x4414, 0x445e, 0x4e95, 0x5164, 0x53d6,
+	0x5517,
+	/* diaspora, year type 12 (5776) */
+	0x0041, 0x0082, 0x00c3, 0x0265, 0x0284, 0x03c5, 0x041f, 0x0446,
+	0x0486, 0x04c6, 0x0506, 0x0547, 0x059b, 0x05c8, 0x0aa3, 0x1549,
+	0x1589, 0x15c9, 0x1609, 0x1649, 0x1689, 0x16c9, 0x1709, 0x190a,
+	0x218b, 0x2561, 0x300c, 0x304d, 0x308e, 0x37cf, 0x3820, 0x3850,
+	0x3890, 0x38d0, 0x3910, 0x395c, 0x399d, 0x3ad8, 0x3c59, 0x3c91,
+	0x4012, 0x429a, 0x4413, 0x4454, 0x449e, 0x4ed5, 0x51a4, 0x5416,
+	0x5557,
+	/* diaspora, year type 13 (5771) */
+	0x0041, 0x0082, 0x0103, 0x0265, 0x0284, 0x03c5, 0x041f, 0x0446,
+	0x0486, 0x04c6, 0x0506, 0x0547, 0x059b, 0x05c8, 0x0aa3, 0x1549,
+	0x1589, 0x15c9, 0x1609, 0x1649, 0x1689, 0x16c9, 0x1709, 0x190a,
+	0x218b, 0x2561, 0x2f8c, 0x304d, 0x308e, 0x37cf, 0x3820, 0x3850,
+	0x3890, 0x38d0, 0x3910, 0x395c, 0x399d, 0x3b18, 0x3cd9, 0x3d11,
+	0x4012, 0x429a, 0x4413, 0x4454, 0x449e, 0x4e95, 0x51a4, 0x53d6,
+	0x5557,
+	/* diaspora, year type 14 (5787) */
+	0x0041, 0x0082, 0x00c3, 0x0265, 0x0284, 0x03c5, 0x041f, 0x0446,
+	0x0486, 0x04c6, 0x0506, 0x0547, 0x059b, 0x05c8, 0x0a63, 0x1549,
+	0x1589, 0x15c9, 0x1609, 0x1649, 0x1689, 0x16c9, 0x1709, 0x190a,
+	0x218b, 0x2561, 0x300c, 0x304d, 0x308e, 0x37cf, 0x3820, 0x3850,
+	0x3890, 0x38d0, 0x3910, 0x395c, 0x399d, 0x3ad8, 0x3c99, 0x3cd1,
+	0x4012, 0x429a, 0x4413, 0x4454, 0x449e, 0x4e95, 0x51a4, 0x53d6,
+	0x5557
+};
+
+static const unsigned short hdate_holyday_table_index[29] = {
+	0, 46, 92, 138, 184, 230, 276, 322, 368, 414, 460, 506, 552, 598,
+	644, 693, 742, 791, 840, 889, 938, 987, 1036, 1085, 1134, 1183, 1232, 1281,
+	1330
+};
+
+/* Bit (days & 31) of word (days >> 5) is set on holydays */
+static const unsigned int hdate_holyday_table_days[28][13] = {
+	{0x007f860e, 0x00000400, 0x0ff00000, 0x00000004, 0x40080010, 0x80000006, 0x0018103f, 0x00030401, 0x04000000, 0x00208040, 0x00000000, 0x00000000, 0x00000000},
+	{0x007f860e, 0x00000200, 0x0ff00000, 0x00000004, 0x00080010, 0x80000007, 0x0003043f, 0x00030401, 0x04000000, 0x00208040, 0x00000000, 0x00000000, 0x00000000},
+	{0x007f860e, 0x00000400, 0x0ff00000, 0x00000008, 0x00100020, 0x0000000e, 0x0018107f, 0x00060802, 0x08000000, 0x00410080, 0x00000000, 0x00000000, 0x00000000},
+	{0x007f8616, 0x00000400, 0x0ff00000, 0x00000008, 0x00100020, 0x0000000e, 0x000c107f, 0x00060802, 0x10000000, 0x00420080, 0x00000000, 0x00000000, 0x00000000},
+	{0x007f860e, 0x00000400, 0x1fe00000, 0x00000010, 0x00200040, 0x0000001c, 0x003020fe, 0x000c1004, 0x10000000, 0x00820100, 0x00000000, 0x00000000, 0x00000000},
+	{0x007f8616, 0x00000400, 0x1fe00000, 0x00000010, 0x00200040, 0x0000001c, 0x000c10fe, 0x000c1004, 0x10000000, 0x00820100, 0x00000000, 0x00000000, 0x00000000},
+	{0x007f860e, 0x00000200, 0x1fe00000, 0x00000010, 0x00200040, 0x00000019, 0x006040fe, 0x000c1004, 0x10000000, 0x00820100, 0x00000000, 0x00000000, 0x00000000},
+	{0x007f860e, 0x00000400, 0x0ff00000, 0x00000004, 0x00080010, 0xc0000000, 0xe0000001, 0x4003020f, 0x0000c100, 0x01000000, 0x00082010, 0x00000000, 0x00000000},
+	{0x007f8616, 0x00000400, 0x0ff00000, 0x00000004, 0x00080010, 0xc0000000, 0xe0000001, 0x4000c10f, 0x0000c100, 0x01000000, 0x00082010, 0x00000000, 0x00000000},
+	{0x007f860e, 0x00000200, 0x0ff00000, 0x00000004, 0x00080010, 0x90000000, 0xe0000001, 0x4006040f, 0x0000c100, 0x01000000, 0x00082010, 0x00000000, 0x00000000},
+	{0x007f860e, 0x00000400, 0x0ff00000, 0x00000008, 0x00100020, 0x80000000, 0xc0000003, 0x8003041f, 0x00018200, 0x04000000, 0x00108020, 0x00000000, 0x00000000},
+	{0x007f860e, 0x00000400, 0x1fe00000, 0x00000010, 0x00200040, 0x00000000, 0x80000007, 0x0006083f, 0x00030401, 0x08000000, 0x00210040, 0x00000000, 0x00000000},
+	{0x007f8616, 0x00000400, 0x1fe00000, 0x00000010, 0x00200040, 0x40000000, 0x80000006, 0x0018103f, 0x00030401, 0x04000000, 0x00208040, 0x00000000, 0x00000000},
+	{0x007f860e, 0x00000200, 0x1fe00000, 0x00000010, 0x00200040, 0x00000000, 0x80000007, 0x000c083f, 0x00030401, 0x04000000, 0x00208040, 0x00000000, 0x00000000},
+	{0x00ff860e, 0x00000400, 0x0ff00000, 0x00000004, 0x40080010, 0x80000006, 0x0018107f, 0x00070401, 0x04000000, 0x00208040, 0x00000000, 0x00000000, 0x00000000},
+	{0x00ff860e, 0x00000200, 0x0ff00000, 0x00000004, 0x00080010, 0x80000007, 0x0003047f, 0x00070401, 0x04000000, 0x00208040, 0x00000000, 0x00000000, 0x00000000},
+	{0x00ff860e, 0x00000400, 0x0ff00000, 0x00000008, 0x00100020, 0x0000000e, 0x001810ff, 0x000e0802, 0x08000000, 0x00410080, 0x00000000, 0x00000000, 0x00000000},
+	{0x00ff8616, 0x00000400, 0x0ff00000, 0x00000008, 0x00100020, 0x0000000e, 0x000c10ff, 0x000e0802, 0x10000000, 0x00420080, 0x00000000, 0x00000000, 0x00000000},
+	{0x00ff860e, 0x00000400, 0x1fe00000, 0x00000010, 0x00200040, 0x0000001c, 0x003021fe, 0x001c1004, 0x10000000, 0x00820100, 0x00000000, 0x00000000, 0x00000000},
+	{0x00ff8616, 0x00000400, 0x1fe00000, 0x00000010, 0x00200040, 0x0000001c, 0x000c11fe, 0x001c1004, 0x10000000, 0x00820100, 0x00000000, 0x00000000, 0x00000000},
+	{0x00ff860e, 0x00000200, 0x1fe00000, 0x00000010, 0x00200040, 0x00000019, 0x006041fe, 0x001c1004, 0x10000000, 0x00820100, 0x00000000, 0x00000000, 0x00000000},
+	{0x00ff860e, 0x00000400, 0x0ff00000, 0x00000004, 0x00080010, 0xc0000000, 0xe0000001, 0x4003021f, 0x0001c100, 0x01000000, 0x00082010, 0x00000000, 0x00000000},
+	{0x00ff8616, 0x00000400, 0x0ff00000, 0x00000004, 0x00080010, 0xc0000000, 0xe0000001, 0x4000c11f, 0x0001c100, 0x01000000, 0x00082010, 0x00000000, 0x00000000},
+	{0x00ff860e, 0x00000200, 0x0ff00000, 0x00000004, 0x00080010, 0x90000000, 0xe0000001, 0x4006041f, 0x0001c100, 0x01000000, 0x00082010, 0x00000000, 0x00000000},
+	{0x00ff860e, 0x00000400, 0x0ff00000, 0x00000008, 0x00100020, 0x80000000, 0xc0000003, 0x8003043f, 0x00038200, 0x04000000, 0x00108020, 0x00000000, 0x00000000},
+	{0x00ff860e, 0x00000400, 0x1fe00000, 0x00000010, 0x00200040, 0x00000000, 0x80000007, 0x0006087f, 0x00070401, 0x08000000, 0x00210040, 0x00000000, 0x00000000},
+	{0x00ff8616, 0x00000400, 0x1fe00000, 0x00000010, 0x00200040, 0x40000000, 0x80000006, 0x0018107f, 0x00070401, 0x04000000, 0x00208040, 0x00000000, 0x00000000},
+	{0x00ff860e, 0x00000200, 0x1fe00000, 0x00000010, 0x00200040, 0x00000000, 0x80000007, 0x000c087f, 0x00070401, 0x04000000, 0x00208040, 0x00000000, 0x00000000}
+};
+
+/* Number of a list's events before each word of its bitmap */
+static const unsigned char hdate_holyday_table_rank[28][13] = {
+	{0, 13, 14, 22, 23, 26, 29, 38, 42, 43, 46, 46, 46},
+	{0, 13, 14, 22, 23, 25, 29, 38, 42, 43, 46, 46, 46},
+	{0, 13, 14, 22, 23, 25, 28, 38, 42, 43, 46, 46, 46},
+	{0, 13, 14, 22, 23, 25, 28, 38, 42, 43, 46, 46, 46},
+	{0, 13, 14, 22, 23, 25, 28, 38, 42, 43, 46, 46, 46},
+	{0, 13, 14, 22, 23, 25, 28, 38, 42, 43, 46, 46, 46},
+	{0, 13, 14, 22, 23, 25, 28, 38, 42, 43, 46, 46, 46},
+	{0, 13, 14, 22, 23, 25, 27, 31, 39, 42, 43, 46, 46},
+	{0, 13, 14, 22, 23, 25, 27, 31, 39, 42, 43, 46, 46},
+	{0, 13, 14, 22, 23, 25, 27, 31, 39, 42, 43, 46, 46},
+	{0, 13, 14, 22, 23, 25, 26, 30, 39, 42, 43, 46, 46},
+	{0, 13, 14, 22, 23, 25, 25, 29, 38, 42, 43, 46, 46},
+	{0, 13, 14, 22, 23, 25, 26, 29, 38, 42, 43, 46, 46},
+	{0, 13, 14, 22, 23, 25, 25, 29, 38, 42, 43, 46, 46},
+	{0, 14, 15, 23, 24, 27, 30, 40, 45, 46, 49, 49, 49},
+	{0, 14, 15, 23, 24, 26, 30, 40, 45, 46, 49, 49, 49},
+	{0, 14, 15, 23, 24, 26, 29, 40, 45, 46, 49, 49, 49},
+	{0, 14, 15, 23, 24, 26, 29, 40, 45, 46, 49, 49, 49},
+	{0, 14, 15, 23, 24, 26, 29, 40, 45, 46, 49, 49, 49},
+	{0, 14, 15, 23, 24, 26, 29, 40, 45, 46, 49, 49, 49},
+	{0, 14, 15, 23, 24, 26, 29, 40, 45, 46, 49, 49, 49},
+	{0, 14, 15, 23, 24, 26, 28, 32, 41, 45, 46, 49, 49},
+	{0, 14, 15, 23, 24, 26, 28, 32, 41, 45, 46, 49, 49},
+	{0, 14, 15, 23, 24, 26, 28, 32, 41, 45, 46, 49, 49},
+	{0, 14, 15, 23, 24, 26, 27, 31, 41, 45, 46, 49, 49},
+	{0, 14, 15, 23, 24, 26, 26, 30, 40, 45, 46, 49, 49},
+	{0, 14, 15, 23, 24, 26, 27, 30, 40, 45, 46, 49, 49},
+	{0, 14, 15, 23, 24, 26, 26, 30, 40, 45, 46, 49, 49}
+};
@@ -23,12 +23,56 @@
 #include "hdate.h"
 #include "support.h"
 
+#ifndef HDATE_NO_NEW_YEAR_TABLE
+#include "hdate_new_year_table.h"
+
+/* Length of year by year type 1..14 */
+static const short year_type_sizes[14] =
+	{353, 353, 354, 354, 355, 355, 355, 383, 383, 383, 384, 385, 385, 385};
+#endif
+
 #define HOUR 1080
 #define DAY  (24*HOUR)
 #define WEEK (7*DAY)
 #define M(h,p) ((h)*HOUR+p)
 #define MONTH (DAY+M(12,793))	/* Tikun for regular month */
 
+/* Number of cached year descriptors, must be a power of 2 */
+#define YEAR_CACHE_SIZE 4
+
+/* Year descriptors cache, an empty slot has size_of_year 0; one per
+   thread (see HDATE_THREAD_LOCAL) */
+static HDATE_THREAD_LOCAL hdate_year_info year_cache[YEAR_CACHE_SIZE];
+
+/**
+ @brief Postpone the new year from the molad day (Molad Zaken and ADU rules)
+ 
+ @param days Days since 3,1,3744 of the molad
+ @param week_day Week day of the molad, 0 - saturday
+ @param parts_left_in_day Parts of the molad into its day
+ @param leap_left Months left of leap cycle
+ @return Number of days since 3,1,3744 of the new year
+*/
+static int
+hdate_postpone_new_year (int days, int week_day, int parts_left_in_day, int leap_left)
+{
+	int postpone;
+	
+	/* Special cases of Molad Zaken; the tests are combined without
+	   branches, scattered years would mispredict them */
+	postpone = ((leap_left < 12) & (week_day == 3)
+	            & (parts_left_in_day >= M (9 + 6, 204))) |
+	           ((leap_left < 7) & (week_day == 2)
+	            & (parts_left_in_day >= M (15 + 6, 589)));
+	days += postpone;
+	week_day += postpone;
+	
+	/* ADU, bits 1, 4 and 6 of 0x52 */
+	days += (0x52 >> week_day) & 1;
+	
+	return days;
+}
+
 /**
  @brief Days since bet (?) Tishrey 3744
  
@@ -69,22 +113,7 @@ hdate_days_from_3744 (int hebrew_year)
 	parts_left_in_day = parts % DAY;
 	week_day = parts_left_in_week / DAY;
 
-	/* Special cases of Molad Zaken */
-	if ((leap_left < 12 && week_day == 3
-	     && parts_left_in_day >= M (9 + 6, 204)) ||
-	    (leap_left < 7 && week_day == 2
-	     && parts_left_in_day >= M (15 + 6, 589)))
-	{
-		days++, week_day++;
-	}
-
-	/* ADU */
-	if (week_day == 1 || week_day == 4 || week_day == 6)
-	{
-		days++;
-	}
-
-	return days;
+	return hdate_postpone_new_year (days, week_day, parts_left_in_day, leap_left);
 }
 
 /**
@@ -96,8 +125,79 @@ hdate_days_from_3744 (int hebrew_year)
 int
 hdate_get_size_of_hebrew_year (int hebrew_year)
 {
-	return hdate_days_from_3744 (hebrew_year + 1) -
-		hdate_days_from_3744 (hebrew_year);
+	hdate_year_info info;
+	
+	return hdate_get_year_info (hebrew_year, &info)->size_of_year;
+}
+
+/**
+ @brief Julian days of 1 Tishrey of a Hebrew year and of the next one
+ 
+ Next year molad is 12 or 13 months after this year molad, so both
+ new years come out of a single molad evaluation.
+ 
+ @param hebrew_year The Hebrew year
+ @param jd_tishrey1 return the julian number of 1 Tishrey this year
+ @param jd_tishrey1_next_year return the julian number of 1 Tishrey next year
+*/
+void
+hdate_get_jd_tishrey1 (int hebrew_year, int *jd_tishrey1, int *jd_tishrey1_next_year)
+{
+	int years_from_3744;
+	int leap_months;
+	int leap_left;
+	int months;
+	int parts;
+	int molad_day;
+	int days;
+	int parts_left_in_day;
+	int week_day;
+	int leap;
+	int carry;
+	
+	/* Start point for calculation is Molad new year 3744 (16BC) */
+	years_from_3744 = hebrew_year - 3744;
+	
+	/* Before 3744 divisions round the wrong way, keep the plain path */
+	if (years_from_3744 < 0)
+	{
+		*jd_tishrey1 = hdate_days_from_3744 (hebrew_year) + 1715119;
+		*jd_tishrey1_next_year = hdate_days_from_3744 (hebrew_year + 1) + 1715119;
+		return;
+	}
+	
+	/* Time in months */
+	leap_months = (years_from_3744 * 7 + 1) / 19;	/* Number of leap months */
+	leap_left = (years_from_3744 * 7 + 1) - 19 * leap_months;	/* Months left of leap cycle */
+	months = years_from_3744 * 12 + leap_months;	/* Total Number of months */
+	
+	/* Time in parts and days */
+	parts = months * MONTH + M (1 + 6, 779);	/* Molad This year + Molad 3744 - corections */
+	molad_day = parts / DAY;
+	days = months * 28 + molad_day - 2;	/* 28 days in month + corections */
+	parts_left_in_day = parts - molad_day * DAY;
+	week_day = molad_day % 7;	/* 28 % 7 = 0 so only corections counts */
+	
+	*jd_tishrey1 = hdate_postpone_new_year (days, week_day, parts_left_in_day, leap_left) + 1715119;
+	
+	/* Step the molad to next year, 12 months are 12 * 28 + 18 days
+	   and 9516 parts, 13 months are 13 * 28 + 19 days and 23269 parts;
+	   without branches, scattered years would mispredict them */
+	leap = (leap_left >= 12); /* this year is leap */
+	leap_left += 7 - 19 * leap;
+	days += 12 * 28 + 18 + (28 + 1) * leap;
+	week_day += 4 + leap; /* 18 % 7 and 19 % 7 */
+	parts_left_in_day += 9516 + (23269 - 9516) * leap;
+	
+	/* carry a whole day, then week_day is at most 6 + 5 + 1 */
+	carry = (parts_left_in_day >= DAY);
+	parts_left_in_day -= DAY * carry;
+	days += carry;
+	week_day += carry;
+	if (week_day >= 7)
+		week_day -= 7;
+	
+	*jd_tishrey1_next_year = hdate_postpone_new_year (days, week_day, parts_left_in_day, leap_left) + 1715119;
 }
 
 /**
@@ -126,8 +226,9 @@ hdate_get_size_of_hebrew_year (int hebrew_year)
 int
 hdate_get_year_type (int size_of_year, int new_year_dw)
 {
-	/* Only 14 combinations of size and week day are posible */
-	static int year_types[24] =
+	/* Only 14 combinations of size and week day are posible; a byte
+	   each, packing two in a byte would slow down the lookup */
+	static const unsigned char year_types[24] =
 		{1, 0, 0, 2, 0, 3, 4, 0, 5, 0, 6, 7,
 		8, 0, 9, 10, 0, 11, 0, 0, 12, 0, 13, 14};
 	
@@ -140,9 +241,64 @@ hdate_get_year_type (int size_of_year, int new_year_dw)
 	offset = offset + 4 * ((size_of_year % 10 - 3) + (size_of_year / 10 - 35));
 	
 	/* some combinations are imposible */
+	if (offset < 1 || offset > 24)
+		return 0;
+	
 	return year_types[offset - 1];
 }
 
+/**
+ @brief Get the descriptor of a Hebrew year
+ 
+ Descriptors are kept in a small cache keyed by year, so repeated
+ conversions in the same year do not redo the molad arithmetic.
+ 
+ @param hebrew_year The Hebrew year
+ @param info return the year descriptor
+ @return pointer to info
+*/
+hdate_year_info *
+hdate_get_year_info (int hebrew_year, hdate_year_info *info)
+{
+	hdate_year_info *cached;
+	int jd_tishrey1_next_year;
+#ifndef HDATE_NO_NEW_YEAR_TABLE
+	int entry;
+	
+	/* Years of the built in table need no molad arithmetic */
+	if (hebrew_year >= HDATE_NEW_YEAR_TABLE_FIRST_YEAR &&
+	    hebrew_year <= HDATE_NEW_YEAR_TABLE_LAST_YEAR)
+	{
+		entry = hdate_new_year_table[hebrew_year - HDATE_NEW_YEAR_TABLE_FIRST_YEAR];
+		info->year = hebrew_year;
+		info->jd_tishrey1 = HDATE_NEW_YEAR_TABLE_FIRST_JD +
+			365 * (hebrew_year - HDATE_NEW_YEAR_TABLE_FIRST_YEAR) + (entry >> 4);
+		info->year_type = entry & 0xf;
+		info->size_of_year = year_type_sizes[info->year_type - 1];
+		info->leap = (info->size_of_year > 355);
+		
+		return info;
+	}
+#endif
+	
+	cached = &year_cache[hebrew_year & (YEAR_CACHE_SIZE - 1)];
+	
+	/* Fill the slot on a miss */
+	if (cached->size_of_year == 0 || cached->year != hebrew_year)
+	{
+		cached->year = hebrew_year;
+		hdate_get_jd_tishrey1 (hebrew_year, &cached->jd_tishrey1, &jd_tishrey1_next_year);
+		cached->size_of_year = jd_tishrey1_next_year - cached->jd_tishrey1;
+		cached->year_type = hdate_get_year_type (cached->size_of_year,
+			(cached->jd_tishrey1 + 1) % 7 + 1);
+		cached->leap = (cached->size_of_year > 355);
+	}
+	
+	*info = *cached;
+	
+	return info;
+}
+
 /**
  @brief Compute Julian day from Gregorian day, month and year
  Algorithm from the wikipedia's julian_day 
@@ -172,22 +328,16 @@ hdate_gdate_to_jd (int day, int month, int year)
 }
 
 /**
- @brief Compute Julian day from Hebrew day, month and year
+ @brief Days from 1 Tishrey to a Hebrew day and month
  
- @author Amos Shapir 1984 (rev. 1985, 1992) Yaacov Zamir 2003-2005
-
+ @param info The year descriptor
  @param day Day of month 1..31
  @param month Month 1..14 (13 - Adar 1, 14 - Adar 2)
- @param year Hebrew year in 4 digits e.g. 5753
- @return The julian day number
- */
-int
-hdate_hdate_to_jd (int day, int month, int year, int *jd_tishrey1, int *jd_tishrey1_next_year)
+ @return Number of days since 1 Tishrey, 0 for 1 Tishrey
+*/
+static int
+hdate_days_from_tishrey1 (hdate_year_info const *info, int day, int month)
 {
-	int length_of_year;
-	int jd;
-	int days_from_3744;
-
 	/* Adjust for leap year */
 	if (month == 13)
 	{
@@ -198,33 +348,154 @@ hdate_hdate_to_jd (int day, int month, int year, int *jd_tishrey1, int *jd_tishr
 		month = 6;
 		day += 30;
 	}
-
-	/* Calculate days since 1,1,3744 */
-	days_from_3744 = hdate_days_from_3744 (year);
-	day = days_from_3744 + (59 * (month - 1) + 1) / 2 + day;
-
-	/* length of year */
-	length_of_year = hdate_days_from_3744 (year + 1) - days_from_3744;
+	
+	day = (59 * (month - 1) + 1) / 2 + day - 1;
 	
 	/* Special cases for this year */
-	if (length_of_year % 10 > 4 && month > 2)	/* long Heshvan */
+	if (info->size_of_year % 10 > 4 && month > 2)	/* long Heshvan */
 		day++;
-	if (length_of_year % 10 < 4 && month > 3)	/* short Kislev */
+	if (info->size_of_year % 10 < 4 && month > 3)	/* short Kislev */
 		day--;
-	if (length_of_year > 365 && month > 6)	/* leap year */
+	if (info->leap && month > 6)	/* leap year */
 		day += 30;
+	
+	return day;
+}
 
-	/* adjust to julian */
-	jd = day + 1715118;
-
+/**
+ @brief Compute Julian day from Hebrew day, month and year
+ 
+ @author Amos Shapir 1984 (rev. 1985, 1992) Yaacov Zamir 2003-2005
+ 
+ @param day Day of month 1..31
+ @param month Month 1..14 (13 - Adar 1, 14 - Adar 2)
+ @param year Hebrew year in 4 digits e.g. 5753
+ @param jd_tishrey1 return the julian number of 1 Tishrey this year
+ @param jd_tishrey1_next_year return the julian number of 1 Tishrey next year
+ @return The julian day number
+*/
+int
+hdate_hdate_to_jd (int day, int month, int year, int *jd_tishrey1, int *jd_tishrey1_next_year)
+{
+	hdate_year_info info;
+	
+	hdate_get_year_info (year, &info);
+	
 	/* return the 1 of tishrey julians */
 	if (jd_tishrey1 && jd_tishrey1_next_year)
 	{
-		*jd_tishrey1 = days_from_3744 + 1715119;
-		*jd_tishrey1_next_year = *jd_tishrey1 + length_of_year;
+		*jd_tishrey1 = info.jd_tishrey1;
+		*jd_tishrey1_next_year = info.jd_tishrey1 + info.size_of_year;
+	}
+	
+	return info.jd_tishrey1 + hdate_days_from_tishrey1 (&info, day, month);
+}
+
+/**
+ @brief Compute Julian days from an array of Hebrew dates
+ 
+ The year descriptor is only looked up again when the year changes.
+ 
+ @param dates Hebrew dates to convert
+ @param count Number of dates
+ @param jd return count julian day numbers
+*/
+void
+hdate_hdate_to_jd_bulk (hdate_date const dates[], int count, int jd[])
+{
+	hdate_year_info info;
+	int i;
+	
+	for (i = 0; i < count; i++)
+	{
+		if (i == 0 || dates[i].year != info.year)
+			hdate_get_year_info (dates[i].year, &info);
+		
+		jd[i] = info.jd_tishrey1 + hdate_days_from_tishrey1 (&info, dates[i].day, dates[i].month);
 	}
 	
-	return jd;
+	return;
+}
+
+/**
+ @brief Length of a Hebrew month in days
+ 
+ @param size_of_year Length of the year in days
+ @param month Month 1..14 (13 - Adar 1, 14 - Adar 2)
+ @return Number of days in the month
+*/
+static int
+hdate_get_month_length (int size_of_year, int month)
+{
+	/* Odd months have 30 days, even months 29, Adar I has 30 */
+	if (month == 2 && size_of_year % 10 > 4) /* long Heshvan */
+		return 30;
+	if (month == 3 && size_of_year % 10 < 4) /* short Kislev */
+		return 29;
+	if (month == 13)
+		return 30;
+	
+	return 30 - ((month + 1) & 1);
+}
+
+/**
+ @brief Converting a span of Julian days to Hebrew dates
+ 
+ The year is resolved once for the first day, then days, months and
+ years are stepped using the month lengths of the year.
+ 
+ @param jd_start Julian day of the first date
+ @param count Number of consecutive days to convert
+ @param out return count Hebrew dates
+*/
+void
+hdate_jd_range_to_hdate (int jd_start, int count, hdate_date out[])
+{
+	int day, month, year;
+	int month_length;
+	int i;
+	hdate_year_info info;
+	
+	if (count <= 0)
+		return;
+	
+	hdate_jd_to_hdate (jd_start, &day, &month, &year, NULL, NULL);
+	hdate_get_year_info (year, &info);
+	month_length = hdate_get_month_length (info.size_of_year, month);
+	
+	for (i = 0; i < count; i++)
+	{
+		out[i].day = day;
+		out[i].month = month;
+		out[i].year = year;
+		
+		if (day < month_length)
+		{
+			day++;
+			continue;
+		}
+		
+		/* next month */
+		day = 1;
+		if (month == 12) /* new year */
+		{
+			month = 1;
+			year++;
+			hdate_get_year_info (year, &info);
+		}
+		else if (month == 5 && info.leap)
+			month = 13;
+		else if (month == 13)
+			month = 14;
+		else if (month == 14)
+			month = 7;
+		else
+			month++;
+		
+		month_length = hdate_get_month_length (info.size_of_year, month);
+	}
+	
+	return;
 }
 
 /**
@@ -271,29 +542,25 @@ hdate_jd_to_hdate (int jd, int *day, int *month, int *year, int *jd_tishrey1, in
 {
 	int days;
 	int size_of_year;
-	int internal_jd_tishrey1, internal_jd_tishrey1_next_year;
+	hdate_year_info info;
 	
-	/* calculate Gregorian date */
-	hdate_jd_to_gdate (jd, day, month, year);
-
-	/* Guess Hebrew year is Gregorian year + 3760 */
-	*year = *year + 3760;
-
-	internal_jd_tishrey1 = hdate_days_from_3744 (*year) + 1715119;
-	internal_jd_tishrey1_next_year = hdate_days_from_3744 (*year + 1) + 1715119;
+	/* Guess Hebrew year from the mean year length, 19 years are about
+	   6940 days; the offset keeps the guess from ever being too high */
+	*year = (19 * (jd + 17452)) / 6940 - 1000;
+	
+	hdate_get_year_info (*year, &info);
 	
 	/* Check if computed year was underestimated */
-	if (internal_jd_tishrey1_next_year <= jd)
+	if (info.jd_tishrey1 + info.size_of_year <= jd)
 	{
 		*year = *year + 1;
-		internal_jd_tishrey1 = internal_jd_tishrey1_next_year;
-		internal_jd_tishrey1_next_year = hdate_days_from_3744 (*year + 1) + 1715119;
+		hdate_get_year_info (*year, &info);
 	}
 
-	size_of_year = internal_jd_tishrey1_next_year - internal_jd_tishrey1;
+	size_of_year = info.size_of_year;
 	
 	/* days into this year, first month 0..29 */
-	days = jd - internal_jd_tishrey1;
+	days = jd - info.jd_tishrey1;
 	
 	/* last 8 months allways have 236 days */
 	if (days >= (size_of_year - 236)) /* in last 8 months */
@@ -338,8 +605,8 @@ hdate_jd_to_hdate (int jd, int *day, int *month, int *year, int *jd_tishrey1, in
 	/* return the 1 of tishrey julians */
 	if (jd_tishrey1 && jd_tishrey1_next_year)
 	{
-		*jd_tishrey1 = internal_jd_tishrey1;
-		*jd_tishrey1_next_year = internal_jd_tishrey1_next_year;
+		*jd_tishrey1 = info.jd_tishrey1;
+		*jd_tishrey1_next_year = info.jd_tishrey1 + info.size_of_year;
 	}
 	
 	return;
@@ -359,7 +626,7 @@ hdate_struct *
 hdate_set_gdate (hdate_struct * h, int d, int m, int y)
 {
 	int jd;
-	int jd_tishrey1, jd_tishrey1_next_year;
+	hdate_year_info info;
 	
 	if (!h) return NULL;
 	
@@ -381,14 +648,16 @@ hdate_set_gdate (hdate_struct * h, int d, int m, int y)
 	h->gd_year = y;
 	
 	jd = hdate_gdate_to_jd (d, m, y);
-	hdate_jd_to_hdate (jd, &(h->hd_day), &(h->hd_mon), &(h->hd_year), &jd_tishrey1, &jd_tishrey1_next_year);
+	hdate_jd_to_hdate (jd, &(h->hd_day), &(h->hd_mon), &(h->hd_year), NULL, NULL);
+	
+	hdate_get_year_info (h->hd_year, &info);
 	
 	h->hd_dw = (jd + 1) % 7 + 1;
-	h->hd_size_of_year = jd_tishrey1_next_year - jd_tishrey1;
-	h->hd_new_year_dw = (jd_tishrey1 + 1) % 7 + 1;
-	h->hd_year_type = hdate_get_year_type (h->hd_size_of_year , h->hd_new_year_dw);
+	h->hd_size_of_year = info.size_of_year;
+	h->hd_new_year_dw = (info.jd_tishrey1 + 1) % 7 + 1;
+	h->hd_year_type = info.year_type;
 	h->hd_jd = jd;
-	h->hd_days = jd - jd_tishrey1 + 1;
+	h->hd_days = jd - info.jd_tishrey1 + 1;
 	h->hd_weeks = ((h->hd_days - 1) + (h->hd_new_year_dw - 1)) / 7 + 1;
 	
 	return (h);
@@ -405,7 +674,7 @@ hdate_struct *
 hdate_set_hdate (hdate_struct * h, int d, int m, int y)
 {
 	int jd;
-	int jd_tishrey1, jd_tishrey1_next_year;
+	hdate_year_info info;
 	
 	if (!h) return NULL;
 	
@@ -413,15 +682,17 @@ hdate_set_hdate (hdate_struct * h, int d, int m, int y)
 	h->hd_mon = m;
 	h->hd_year = y;
 	
-	jd = hdate_hdate_to_jd (d, m, y, &jd_tishrey1, &jd_tishrey1_next_year);
+	jd = hdate_hdate_to_jd (d, m, y, NULL, NULL);
 	hdate_jd_to_gdate (jd, &(h->gd_day), &(h->gd_mon), &(h->gd_year));
 	
+	hdate_get_year_info (h->hd_year, &info);
+	
 	h->hd_dw = (jd + 1) % 7 + 1;
-	h->hd_size_of_year = jd_tishrey1_next_year - jd_tishrey1;
-	h->hd_new_year_dw = (jd_tishrey1 + 1) % 7 + 1;
-	h->hd_year_type = hdate_get_year_type (h->hd_size_of_year , h->hd_new_year_dw);
+	h->hd_size_of_year = info.size_of_year;
+	h->hd_new_year_dw = (info.jd_tishrey1 + 1) % 7 + 1;
+	h->hd_year_type = info.year_type;
 	h->hd_jd = jd;
-	h->hd_days = jd - jd_tishrey1 + 1;
+	h->hd_days = jd - info.jd_tishrey1 + 1;
 	h->hd_weeks = ((h->hd_days - 1) + (h->hd_new_year_dw - 1)) / 7 + 1;
 	
 	return (h);
@@ -435,24 +706,159 @@ hdate_set_hdate (hdate_struct * h, int d, int m, int y)
 hdate_struct *
 hdate_set_jd (hdate_struct * h, int jd)
 {
-	int jd_tishrey1, jd_tishrey1_next_year;
+	hdate_year_info info;
 	
 	if (!h) return NULL;
 	
 	hdate_jd_to_gdate (jd, &(h->gd_day), &(h->gd_mon), &(h->gd_year));
-	hdate_jd_to_hdate (jd, &(h->hd_day), &(h->hd_mon), &(h->hd_year), &jd_tishrey1, &jd_tishrey1_next_year);
+	hdate_jd_to_hdate (jd, &(h->hd_day), &(h->hd_mon), &(h->hd_year), NULL, NULL);
+	
+	hdate_get_year_info (h->hd_year, &info);
 	
 	h->hd_dw = (jd + 1) % 7 + 1;
-	h->hd_size_of_year = jd_tishrey1_next_year - jd_tishrey1;
-	h->hd_new_year_dw = (jd_tishrey1 + 1) % 7 + 1;
-	h->hd_year_type = hdate_get_year_type (h->hd_size_of_year , h->hd_new_year_dw);
+	h->hd_size_of_year = info.size_of_year;
+	h->hd_new_year_dw = (info.jd_tishrey1 + 1) % 7 + 1;
+	h->hd_year_type = info.year_type;
 	h->hd_jd = jd;
-	h->hd_days = jd - jd_tishrey1 + 1;
+	h->hd_days = jd - info.jd_tishrey1 + 1;
 	h->hd_weeks = ((h->hd_days - 1) + (h->hd_new_year_dw - 1)) / 7 + 1;
 	
 	return (h);
 }
 
+/**
+ @brief Length of a Gregorian month in days
+ 
+ @param month Month 1..12
+ @param year Year in 4 digits e.g. 2001
+ @return Number of days in the month
+*/
+static int
+hdate_get_gmonth_length (int month, int year)
+{
+	if (month == 2)
+		return 28 + (year % 4 == 0 && (year % 100 != 0 || year % 400 == 0));
+	
+	/* 31 days in odd months up to july, in even months from august */
+	return 30 + ((month + (month >> 3)) & 1);
+}
+
+/**
+ @brief move date structure to the next day
+
+ Only the new year is computed from scratch, other days are stepped
+ from the month lengths.
+
+ @param h pointer this hdate struct.
+ @return pointer to this hdate struct
+ */
+hdate_struct *
+hdate_next_day (hdate_struct * h)
+{
+	if (!h) return NULL;
+	
+	/* 1 tishrey, new year */
+	if (h->hd_days >= h->hd_size_of_year)
+		return hdate_set_jd (h, h->hd_jd + 1);
+	
+	h->hd_jd++;
+	h->hd_days++;
+	h->hd_dw = h->hd_dw % 7 + 1;
+	if (h->hd_dw == 1)
+		h->hd_weeks++;
+	
+	/* Hebrew day, elul is never left here */
+	if (h->hd_day < hdate_get_month_length (h->hd_size_of_year, h->hd_mon))
+		h->hd_day++;
+	else
+	{
+		h->hd_day = 1;
+		if (h->hd_mon == 5 && h->hd_size_of_year > 355)
+			h->hd_mon = 13;
+		else if (h->hd_mon == 13)
+			h->hd_mon = 14;
+		else if (h->hd_mon == 14)
+			h->hd_mon = 7;
+		else
+			h->hd_mon++;
+	}
+	
+	/* Gregorian day */
+	if (h->gd_day < hdate_get_gmonth_length (h->gd_mon, h->gd_year))
+		h->gd_day++;
+	else
+	{
+		h->gd_day = 1;
+		if (h->gd_mon == 12)
+		{
+			h->gd_mon = 1;
+			h->gd_year++;
+		}
+		else
+			h->gd_mon++;
+	}
+	
+	return (h);
+}
+
+/**
+ @brief move date structure to the previous day
+
+ Only the last day of the year before is computed from scratch, other
+ days are stepped from the month lengths.
+
+ @param h pointer this hdate struct.
+ @return pointer to this hdate struct
+ */
+hdate_struct *
+hdate_prev_day (hdate_struct * h)
+{
+	if (!h) return NULL;
+	
+	/* 29 elul, last year */
+	if (h->hd_days <= 1)
+		return hdate_set_jd (h, h->hd_jd - 1);
+	
+	h->hd_jd--;
+	h->hd_days--;
+	if (h->hd_dw == 1)
+		h->hd_weeks--;
+	h->hd_dw = (h->hd_dw + 5) % 7 + 1;
+	
+	/* Hebrew day, tishrey is never left here */
+	if (h->hd_day > 1)
+		h->hd_day--;
+	else
+	{
+		if (h->hd_mon == 7 && h->hd_size_of_year > 355)
+			h->hd_mon = 14;
+		else if (h->hd_mon == 14)
+			h->hd_mon = 13;
+		else if (h->hd_mon == 13)
+			h->hd_mon = 5;
+		else
+			h->hd_mon--;
+		h->hd_day = hdate_get_month_length (h->hd_size_of_year, h->hd_mon);
+	}
+	
+	/* Gregorian day */
+	if (h->gd_day > 1)
+		h->gd_day--;
+	else
+	{
+		if (h->gd_mon == 1)
+		{
+			h->gd_mon = 12;
+			h->gd_year--;
+		}
+		else
+			h->gd_mon--;
+		h->gd_day = hdate_get_gmonth_length (h->gd_mon, h->gd_year);
+	}
+	
+	return (h);
+}
+
 /********************************************************************************/
 /********************************************************************************/
 
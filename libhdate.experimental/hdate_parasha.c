@@ -19,80 +19,66 @@
 #include "hdate.h"
 #include "support.h"
 
+#ifndef HDATE_NO_PARASHA_TABLE
+#include "hdate_parasha_table.h"
+#endif
+
+/* The joins of a year type packed in a byte, and one join of a year type */
+#define JOIN_FLAGS(a,b,c,d,e,f,g) ((a) | (b) << 1 | (c) << 2 | (d) << 3 | (e) << 4 | (f) << 5 | (g) << 6)
+#define JOIN_FLAG(diaspora, year_type, join) ((join_flags[diaspora][(year_type) - 1] >> (join)) & 1)
+
 /**
- @brief Return number of hebrew parasha.
+ @brief Return number of hebrew parasha of a shabat, from the reading rules.
  
  @author Yaacov Zamir 2003-2005, Reading tables by Zvi Har'El
 
- @param hebdate The hdate_struct of the date to use.
+ @param hebdate The hdate_struct of the shabat to use.
  @param diaspora if True give diaspora readings
  @return the name of parasha 1. Bereshit etc..
  (55 trow 61 are joined strings e.g. Vayakhel Pekudei)
 */
-int
-hdate_get_parasha (hdate_struct const * h, int diaspora)
+static int
+hdate_get_parasha_by_rules (hdate_struct const * h, int diaspora)
 {
-	static int join_flags[2][14][7] =
+	/* the 7 joins of each year type, bit i for join i (see JOIN_FLAG) */
+	static const unsigned char join_flags[2][14] =
 	{
 		{
-			{1, 1, 1, 1, 0, 1, 1}, /* 1 be erez israel */
-			{1, 1, 1, 1, 0, 1, 0}, /* 2 */
-			{1, 1, 1, 1, 0, 1, 1}, /* 3 */
-			{1, 1, 1, 0, 0, 1, 0}, /* 4 */
-			{1, 1, 1, 1, 0, 1, 1}, /* 5 */
-			{0, 1, 1, 1, 0, 1, 0}, /* 6 */
-			{1, 1, 1, 1, 0, 1, 1}, /* 7 */
-			{0, 0, 0, 0, 0, 1, 1}, /* 8 */
-			{0, 0, 0, 0, 0, 0, 0}, /* 9 */
-			{0, 0, 0, 0, 0, 1, 1}, /* 10 */
-			{0, 0, 0, 0, 0, 0, 0}, /* 11 */
-			{0, 0, 0, 0, 0, 0, 0}, /* 12 */
-			{0, 0, 0, 0, 0, 0, 1}, /* 13 */
-			{0, 0, 0, 0, 0, 1, 1}  /* 14 */
+			JOIN_FLAGS (1, 1, 1, 1, 0, 1, 1), /* 1 be erez israel */
+			JOIN_FLAGS (1, 1, 1, 1, 0, 1, 0), /* 2 */
+			JOIN_FLAGS (1, 1, 1, 1, 0, 1, 1), /* 3 */
+			JOIN_FLAGS (1, 1, 1, 0, 0, 1, 0), /* 4 */
+			JOIN_FLAGS (1, 1, 1, 1, 0, 1, 1), /* 5 */
+			JOIN_FLAGS (0, 1, 1, 1, 0, 1, 0), /* 6 */
+			JOIN_FLAGS (1, 1, 1, 1, 0, 1, 1), /* 7 */
+			JOIN_FLAGS (0, 0, 0, 0, 0, 1, 1), /* 8 */
+			JOIN_FLAGS (0, 0, 0, 0, 0, 0, 0), /* 9 */
+			JOIN_FLAGS (0, 0, 0, 0, 0, 1, 1), /* 10 */
+			JOIN_FLAGS (0, 0, 0, 0, 0, 0, 0), /* 11 */
+			JOIN_FLAGS (0, 0, 0, 0, 0, 0, 0), /* 12 */
+			JOIN_FLAGS (0, 0, 0, 0, 0, 0, 1), /* 13 */
+			JOIN_FLAGS (0, 0, 0, 0, 0, 1, 1)  /* 14 */
 		},
 		{
-			{1, 1, 1, 1, 0, 1, 1}, /* 1 in diaspora */
-			{1, 1, 1, 1, 0, 1, 0}, /* 2 */
-			{1, 1, 1, 1, 1, 1, 1}, /* 3 */
-			{1, 1, 1, 1, 0, 1, 0}, /* 4 */
-			{1, 1, 1, 1, 1, 1, 1}, /* 5 */
-			{0, 1, 1, 1, 0, 1, 0}, /* 6 */
-			{1, 1, 1, 1, 0, 1, 1}, /* 7 */
-			{0, 0, 0, 0, 1, 1, 1}, /* 8 */
-			{0, 0, 0, 0, 0, 0, 0}, /* 9 */
-			{0, 0, 0, 0, 0, 1, 1}, /* 10 */
-			{0, 0, 0, 0, 0, 1, 0}, /* 11 */
-			{0, 0, 0, 0, 0, 1, 0}, /* 12 */
-			{0, 0, 0, 0, 0, 0, 1}, /* 13 */
-			{0, 0, 0, 0, 1, 1, 1}  /* 14 */
+			JOIN_FLAGS (1, 1, 1, 1, 0, 1, 1), /* 1 in diaspora */
+			JOIN_FLAGS (1, 1, 1, 1, 0, 1, 0), /* 2 */
+			JOIN_FLAGS (1, 1, 1, 1, 1, 1, 1), /* 3 */
+			JOIN_FLAGS (1, 1, 1, 1, 0, 1, 0), /* 4 */
+			JOIN_FLAGS (1, 1, 1, 1, 1, 1, 1), /* 5 */
+			JOIN_FLAGS (0, 1, 1, 1, 0, 1, 0), /* 6 */
+			JOIN_FLAGS (1, 1, 1, 1, 0, 1, 1), /* 7 */
+			JOIN_FLAGS (0, 0, 0, 0, 1, 1, 1), /* 8 */
+			JOIN_FLAGS (0, 0, 0, 0, 0, 0, 0), /* 9 */
+			JOIN_FLAGS (0, 0, 0, 0, 0, 1, 1), /* 10 */
+			JOIN_FLAGS (0, 0, 0, 0, 0, 1, 0), /* 11 */
+			JOIN_FLAGS (0, 0, 0, 0, 0, 1, 0), /* 12 */
+			JOIN_FLAGS (0, 0, 0, 0, 0, 0, 1), /* 13 */
+			JOIN_FLAGS (0, 0, 0, 0, 1, 1, 1)  /* 14 */
 		}
 	};
 	
 	int reading;
 	
-	/* if simhat tora return vezot habracha */
-	if (h->hd_mon == 1)
-	{
-		/* simhat tora is a day after shmini atzeret outsite israel */
-		if (h->hd_day == 22 && !diaspora) return 54;
-		if (h->hd_day == 23 && diaspora) return 54;
-	}
-	
-	
-	if (h->hd_mon == 1 && h->hd_day == 22)
-	{
-		return 54;
-	}
-	
-	/* if not shabat return none */
-	if (h->hd_dw != 7)
-	{
-		return 0;
-	}
-	
-	/* check for diaspora readings */
-	diaspora = diaspora?1:0;
-	
 	switch (h->hd_weeks)
 	{
 	case  1:
@@ -192,7 +178,7 @@ hdate_get_parasha (hdate_struct const * h, int diaspora)
 		}
 		
 		/* joining */
-		if (join_flags[diaspora][h->hd_year_type - 1][0] && (reading >= 22))
+		if (JOIN_FLAG (diaspora, h->hd_year_type, 0) && (reading >= 22))
 		{
 			if (reading == 22)
 			{
@@ -203,7 +189,7 @@ hdate_get_parasha (hdate_struct const * h, int diaspora)
 				reading++;
 			}
 		}
-		if (join_flags[diaspora][h->hd_year_type - 1][1] && (reading >= 27))
+		if (JOIN_FLAG (diaspora, h->hd_year_type, 1) && (reading >= 27))
 		{
 			if (reading == 27)
 			{
@@ -214,7 +200,7 @@ hdate_get_parasha (hdate_struct const * h, int diaspora)
 				reading++;
 			}
 		}
-		if (join_flags[diaspora][h->hd_year_type - 1][2] && (reading >= 29))
+		if (JOIN_FLAG (diaspora, h->hd_year_type, 2) && (reading >= 29))
 		{
 			if (reading == 29)
 			{
@@ -225,7 +211,7 @@ hdate_get_parasha (hdate_struct const * h, int diaspora)
 				reading++;
 			}
 		}
-		if (join_flags[diaspora][h->hd_year_type - 1][3] && (reading >= 32))
+		if (JOIN_FLAG (diaspora, h->hd_year_type, 3) && (reading >= 32))
 		{
 			if (reading == 32)
 			{
@@ -237,7 +223,7 @@ hdate_get_parasha (hdate_struct const * h, int diaspora)
 			}
 		}
 		
-		if (join_flags[diaspora][h->hd_year_type - 1][4] && (reading >= 39))
+		if (JOIN_FLAG (diaspora, h->hd_year_type, 4) && (reading >= 39))
 		{
 			if (reading == 39)
 			{
@@ -248,7 +234,7 @@ hdate_get_parasha (hdate_struct const * h, int diaspora)
 				reading++;
 			}
 		}
-		if (join_flags[diaspora][h->hd_year_type - 1][5] && (reading >= 42))
+		if (JOIN_FLAG (diaspora, h->hd_year_type, 5) && (reading >= 42))
 		{
 			if (reading == 42)
 			{
@@ -259,7 +245,7 @@ hdate_get_parasha (hdate_struct const * h, int diaspora)
 				reading++;
 			}
 		}
-		if (join_flags[diaspora][h->hd_year_type - 1][6] && (reading >= 51))
+		if (JOIN_FLAG (diaspora, h->hd_year_type, 6) && (reading >= 51))
 		{
 			if (reading == 51)
 			{
@@ -275,3 +261,51 @@ hdate_get_parasha (hdate_struct const * h, int diaspora)
 
 	return reading;
 }
+
+/**
+ @brief Return number of hebrew parasha.
+ 
+ The readings of a shabat only depend on the year type and the week, and
+ are looked up in the generated table; Simhat tora is checked first.
+
+ @param hebdate The hdate_struct of the date to use.
+ @param diaspora if True give diaspora readings
+ @return the name of parasha 1. Bereshit etc..
+ (55 trow 61 are joined strings e.g. Vayakhel Pekudei)
+*/
+int
+hdate_get_parasha (hdate_struct const * h, int diaspora)
+{
+	/* if simhat tora return vezot habracha */
+	if (h->hd_mon == 1)
+	{
+		/* simhat tora is a day after shmini atzeret outsite israel */
+		if (h->hd_day == 22 && !diaspora) return 54;
+		if (h->hd_day == 23 && diaspora) return 54;
+	}
+	
+	
+	if (h->hd_mon == 1 && h->hd_day == 22)
+	{
+		return 54;
+	}
+	
+	/* if not shabat return none */
+	if (h->hd_dw != 7)
+	{
+		return 0;
+	}
+	
+	/* check for diaspora readings */
+	diaspora = diaspora?1:0;
+	
+#ifndef HDATE_NO_PARASHA_TABLE
+	if (h->hd_year_type >= 1 && h->hd_year_type <= 14 &&
+		h->hd_weeks >= 1 && h->hd_weeks <= HDATE_PARASHA_TABLE_WEEKS)
+	{
+		return hdate_parasha_table[h->hd_year_type - 1][diaspora][h->hd_weeks - 1];
+	}
+#endif
+	
+	return hdate_get_parasha_by_rules (h, diaspora);
+}
@@ -0,0 +1,176 @@
+/* Generated by tools/gen_parasha_table.c, do not edit */
+
+/* Parasha read on the shabat of each week of the year, by
+   [year_type - 1][diaspora][hd_weeks - 1] */
+#define HDATE_PARASHA_TABLE_WEEKS 56
+
+static const unsigned char hdate_parasha_table[14][2][56] = {
+	{
+		/* year type 1, israel */
+		{52, 53, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+		12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 55, 24, 25, 0,
+		26, 56, 57, 31, 58, 34, 35, 36, 37, 38, 39, 40, 41, 60,
+		44, 45, 46, 47, 48, 49, 50, 61, 0, 0, 0, 0, 0, 0},
+		/* year type 1, diaspora */
+		{52, 53, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+		12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 55, 24, 25, 0,
+		26, 56, 57, 31, 58, 34, 35, 36, 37, 38, 39, 40, 41, 60,
+		44, 45, 46, 47, 48, 49, 50, 61, 0, 0, 0, 0, 0, 0}
+	},
+	{
+		/* year type 2, israel */
+		{0, 53, 0, 54, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
+		11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 55, 24, 25,
+		0, 26, 56, 57, 31, 58, 34, 35, 36, 37, 38, 39, 40, 41,
+		60, 44, 45, 46, 47, 48, 49, 50, 51, 0, 0, 0, 0, 0},
+		/* year type 2, diaspora */
+		{0, 53, 0, 54, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
+		11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 55, 24, 25,
+		0, 26, 56, 57, 31, 58, 34, 35, 36, 37, 38, 39, 40, 41,
+		60, 44, 45, 46, 47, 48, 49, 50, 51, 0, 0, 0, 0, 0}
+	},
+	{
+		/* year type 3, israel */
+		{52, 53, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+		12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 55, 24, 25, 0,
+		26, 56, 57, 31, 58, 34, 35, 36, 37, 38, 39, 40, 41, 60,
+		44, 45, 46, 47, 48, 49, 50, 61, 0, 0, 0, 0, 0, 0},
+		/* year type 3, diaspora */
+		{52, 53, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+		12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 55, 24, 25, 0,
+		26, 56, 57, 31, 58, 34, 0, 35, 36, 37, 38, 59, 41, 60,
+		44, 45, 46, 47, 48, 49, 50, 61, 0, 0, 0, 0, 0, 0}
+	},
+	{
+		/* year type 4, israel */
+		{53, 0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+		12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 55, 24, 25, 0,
+		26, 56, 57, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41,
+		60, 44, 45, 46, 47, 48, 49, 50, 51, 0, 0, 0, 0, 0},
+		/* year type 4, diaspora */
+		{53, 0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+		12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 55, 24, 25, 0,
+		0, 26, 56, 57, 31, 58, 34, 35, 36, 37, 38, 39, 40, 41,
+		60, 44, 45, 46, 47, 48, 49, 50, 51, 0, 0, 0, 0, 0}
+	},
+	{
+		/* year type 5, israel */
+		{52, 53, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+		12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 55, 24, 25, 0,
+		26, 56, 57, 31, 58, 34, 35, 36, 37, 38, 39, 40, 41, 60,
+		44, 45, 46, 47, 48, 49, 50, 61, 0, 0, 0, 0, 0, 0},
+		/* year type 5, diaspora */
+		{52, 53, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+		12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 55, 24, 25, 0,
+		26, 56, 57, 31, 58, 34, 0, 35, 36, 37, 38, 59, 41, 60,
+		44, 45, 46, 47, 48, 49, 50, 61, 0, 0, 0, 0, 0, 0}
+	},
+	{
+		/* year type 6, israel */
+		{53, 0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+		12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25,
+		0, 26, 56, 57, 31, 58, 34, 35, 36, 37, 38, 39, 40, 41,
+		60, 44, 45, 46, 47, 48, 49, 50, 51, 0, 0, 0, 0, 0},
+		/* year type 6, diaspora */
+		{53, 0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+		12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25,
+		0, 26, 56, 57, 31, 58, 34, 35, 36, 37, 38, 39, 40, 41,
+		60, 44, 45, 46, 47, 48, 49, 50, 51, 0, 0, 0, 0, 0}
+	},
+	{
+		/* year type 7, israel */
+		{0, 53, 0, 54, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
+		11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 55, 24, 25,
+		0, 26, 56, 57, 31, 58, 34, 35, 36, 37, 38, 39, 40, 41,
+		60, 44, 45, 46, 47, 48, 49, 50, 61, 0, 0, 0, 0, 0},
+		/* year type 7, diaspora */
+		{0, 53, 0, 54, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
+		11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 55, 24, 25,
+		0, 26, 56, 57, 31, 58, 34, 35, 36, 37, 38, 39, 40, 41,
+		60, 44, 45, 46, 47, 48, 49, 50, 61, 0, 0, 0, 0, 0}
+	},
+	{
+		/* year type 8, israel */
+		{52, 53, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+		12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25,
+		26, 27, 28, 0, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38,
+		39, 40, 41, 60, 44, 45, 46, 47, 48, 49, 50, 61, 0, 0},
+		/* year type 8, diaspora */
+		{52, 53, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+		12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25,
+		26, 27, 28, 0, 29, 30, 31, 32, 33, 34, 0, 35, 36, 37,
+		38, 59, 41, 60, 44, 45, 46, 47, 48, 49, 50, 61, 0, 0}
+	},
+	{
+		/* year type 9, israel */
+		{53, 0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+		12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25,
+		26, 27, 28, 29, 0, 30, 31, 32, 33, 34, 35, 36, 37, 38,
+		39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 0},
+		/* year type 9, diaspora */
+		{53, 0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+		12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25,
+		26, 27, 28, 29, 0, 30, 31, 32, 33, 34, 35, 36, 37, 38,
+		39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 0}
+	},
+	{
+		/* year type 10, israel */
+		{0, 53, 0, 54, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
+		11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+		25, 26, 27, 28, 0, 29, 30, 31, 32, 33, 34, 35, 36, 37,
+		38, 39, 40, 41, 60, 44, 45, 46, 47, 48, 49, 50, 61, 0},
+		/* year type 10, diaspora */
+		{0, 53, 0, 54, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
+		11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+		25, 26, 27, 28, 0, 29, 30, 31, 32, 33, 34, 35, 36, 37,
+		38, 39, 40, 41, 60, 44, 45, 46, 47, 48, 49, 50, 61, 0}
+	},
+	{
+		/* year type 11, israel */
+		{52, 53, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+		12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25,
+		26, 27, 28, 0, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38,
+		39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 0},
+		/* year type 11, diaspora */
+		{52, 53, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+		12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25,
+		26, 27, 28, 0, 0, 29, 30, 31, 32, 33, 34, 35, 36, 37,
+		38, 39, 40, 41, 60, 44, 45, 46, 47, 48, 49, 50, 51, 0}
+	},
+	{
+		/* year type 12, israel */
+		{52, 53, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+		12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25,
+		26, 27, 28, 0, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38,
+		39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 0},
+		/* year type 12, diaspora */
+		{52, 53, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+		12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25,
+		26, 27, 28, 0, 0, 29, 30, 31, 32, 33, 34, 35, 36, 37,
+		38, 39, 40, 41, 60, 44, 45, 46, 47, 48, 49, 50, 51, 0}
+	},
+	{
+		/* year type 13, israel */
+		{53, 0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+		12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25,
+		26, 27, 28, 29, 0, 30, 31, 32, 33, 34, 35, 36, 37, 38,
+		39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 61, 0},
+		/* year type 13, diaspora */
+		{53, 0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+		12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25,
+		26, 27, 28, 29, 0, 30, 31, 32, 33, 34, 35, 36, 37, 38,
+		39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 61, 0}
+	},
+	{
+		/* year type 14, israel */
+		{0, 53, 0, 54, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
+		11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+		25, 26, 27, 28, 0, 29, 30, 31, 32, 33, 34, 35, 36, 37,
+		38, 39, 40, 41, 60, 44, 45, 46, 47, 48, 49, 50, 61, 0},
+		/* year type 14, diaspora */
+		{0, 53, 0, 54, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
+		11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+		25, 26, 27, 28, 0, 29, 30, 31, 32, 33, 34, 0, 35, 36,
+		37, 38, 59, 41, 60, 44, 45, 46, 47, 48, 49, 50, 61, 0}
+	}
+};
@@ -0,0 +1,345 @@
+/* Generated by tools/gen_string_pool.c, do not edit */
+
+/* 504 names, 293 distinct (3253 bytes), in a pool of 2929 bytes;
+   the tables hold offsets into the pool, by the indexes of the
+   hdate_string tables of the same names */
+static const char hdate_string_pool[2929] =
+	"Memorial day for fallen whose place of burial is unknown\0"
+	"יום הזכרון ליצחק רבין\0"
+	"צום שבעה עשר בתמוז\0"
+	"אחרי מות-קדושים\0"
+	"חול המועד סוכות\0"
+	"Yitzhak Rabin memorial day\0"
+	"יום ז'בוטינסקי\0"
+	"צום עשרה בטבת\0"
+	"חול המועד פסח\0"
+	"שני של שבועות\0"
+	"אחרון של פסח\0"
+	"שני של סוכות\0"
+	"ויקהל-פקודי\0"
+	"תזריע-מצורע\0"
+	"יום העצמאות\0"
+	"יום הכפורים\0"
+	"יום ירושלים\0"
+	"Zeev Zhabotinsky day\0"
+	"חוה\"מ סוכות\0"
+	"יום זכרון...\0"
+	"Achrei Mot-Kedoshim\0"
+	"וזאת הברכה\0"
+	"בהר-בחוקתי\0"
+	"נצבים-וילך\0"
+	"תענית אסתר\0"
+	"שושן פורים\0"
+	"ערב שבועות\0"
+	"יום הזכרון\0"
+	"שמיני עצרת\0"
+	"יום המשפחה\0"
+	"א' ראש השנה\0"
+	"ב' ראש השנה\0"
+	"הושענא רבה\0"
+	"Nitzavim-Vayeilech\0"
+	"שני של פסח\0"
+	"מטות מסעי\0"
+	"Hol hamoed Sukkot\0"
+	"Hol hamoed Pesach\0"
+	"צום גדליה\0"
+	"יום השואה\0"
+	"שמחת תורה\0"
+	"שביעי פסח\0"
+	"Vayakhel-Pekudei\0"
+	"Behar-Bechukotai\0"
+	"Yom Yerushalayim\0"
+	"חוה\"מ פסח\0"
+	"ל\"ג בעומר\0"
+	"ב' שבועות\0"
+	"אחרי מות\0"
+	"חוקת-בלק\0"
+	"Rosh Hashana II\0"
+	"Erev Yom Kippur\0"
+	"צום תמוז\0"
+	"תשעה באב\0"
+	"Vezot Habracha\0"
+	"Tazria-Metzora\0"
+	"Rosh Hashana I\0"
+	"Ta'anit Esther\0"
+	"Yom HaAtzma'ut\0"
+	"Shmini Atzeret\0"
+	"ט\"ו בשבט\0"
+	"ב' סוכות\0"
+	"חיי שרה\0"
+	"כי תבוא\0"
+	"Tzom Gedaliah\0"
+	"Simchat Torah\0"
+	"Asara B'Tevet\0"
+	"Shushan Purim\0"
+	"Yom HaZikaron\0"
+	"Beha'alotcha\0"
+	"Chukat-Balak\0"
+	"בראשית\0"
+	"תולדות\0"
+	"משפטים\0"
+	"בהעלתך\0"
+	"ואתחנן\0"
+	"שופטים\0"
+	"האזינו\0"
+	"Hoshana raba\0"
+	"Erev Shavuot\0"
+	"י' בטבת\0"
+	"ט\"ו באב\0"
+	"יום י-ם\0"
+	"Chayei Sara\0"
+	"Matot-Masei\0"
+	"כי תשא\0"
+	"כי תצא\0"
+	"Tzom Tammuz\0"
+	"Tish'a B'Av\0"
+	"Yom HaShoah\0"
+	"Pesach VIII\0"
+	"עיוה\"כ\0"
+	"ראשון\0"
+	"שלישי\0"
+	"רביעי\0"
+	"חמישי\0"
+	"Lech-Lecha\0"
+	"Vayishlach\0"
+	"Achrei Mot\0"
+	"Vaetchanan\0"
+	"Ki Teitzei\0"
+	"וישלח\0"
+	"תרומה\0"
+	"ויקהל\0"
+	"ויקרא\0"
+	"שמיני\0"
+	"תזריע\0"
+	"במדבר\0"
+	"דברים\0"
+	"נצבים\0"
+	"Tu B'Shvat\0"
+	"Lag B'Omer\0"
+	"Pesach VII\0"
+	"Shavuot II\0"
+	"Family Day\0"
+	"חנוכה\0"
+	"ט' באב\0"
+	"ז' פסח\0"
+	"ב' פסח\0"
+	"Wednesday\0"
+	"Beshalach\0"
+	"Mishpatim\0"
+	"לך לך\0"
+	"אדר א\0"
+	"אדר ב\0"
+	"September\0"
+	"Sukkot II\0"
+	"Pesach II\0"
+	"ב' ר\"ה\0"
+	"הוש\"ר\0"
+	"שמח\"ת\0"
+	"Thursday\0"
+	"Saturday\0"
+	"שישי\0"
+	"Bereshit\0"
+	"Vayetzei\0"
+	"Vayeshev\0"
+	"Vayigash\0"
+	"Tetzaveh\0"
+	"Vayakhel\0"
+	"Bamidbar\0"
+	"Nitzavim\0"
+	"Ha'Azinu\0"
+	"וירא\0"
+	"ויצא\0"
+	"וישב\0"
+	"ויגש\0"
+	"ויחי\0"
+	"שמות\0"
+	"וארא\0"
+	"בשלח\0"
+	"יתרו\0"
+	"תצוה\0"
+	"אמור\0"
+	"פנחס\0"
+	"מטות\0"
+	"Cheshvan\0"
+	"תשרי\0"
+	"חשון\0"
+	"כסלו\0"
+	"ניסן\0"
+	"אייר\0"
+	"סיון\0"
+	"אלול\0"
+	"February\0"
+	"November\0"
+	"December\0"
+	"Chanukah\0"
+	"א ר\"ה\0"
+	"Tuesday\0"
+	"Vayechi\0"
+	"Terumah\0"
+	"Ki Tisa\0"
+	"Vayikra\0"
+	"Sh'lach\0"
+	"Pinchas\0"
+	"Devarim\0"
+	"Shoftim\0"
+	"Ki Tavo\0"
+	"Tishrei\0"
+	"Adar II\0"
+	"January\0"
+	"October\0"
+	"Tu B'Av\0"
+	"Sunday\0"
+	"Monday\0"
+	"Friday\0"
+	"שני\0"
+	"שבת\0"
+	"Vayera\0"
+	"Toldot\0"
+	"Miketz\0"
+	"Shemot\0"
+	"Shmini\0"
+	"Tazria\0"
+	"Korach\0"
+	"Chukat\0"
+	"מקץ\0"
+	"בהר\0"
+	"נשא\0"
+	"קרח\0"
+	"חקת\0"
+	"עקב\0"
+	"ראה\0"
+	"Kislev\0"
+	"Sh'vat\0"
+	"Adar I\0"
+	"אדר\0"
+	"August\0"
+	"Noach\0"
+	"Vaera\0"
+	"Yitro\0"
+	"Behar\0"
+	"Nasso\0"
+	"Matot\0"
+	"Eikev\0"
+	"Re'eh\0"
+	"Nisan\0"
+	"Iyyar\0"
+	"Sivan\0"
+	"March\0"
+	"April\0"
+	"Tzav\0"
+	"Emor\0"
+	"נח\0"
+	"בא\0"
+	"צו\0"
+	"Adar\0"
+	"Elul\0"
+	"June\0"
+	"July\0"
+	"Sun\0"
+	"Mon\0"
+	"Tue\0"
+	"Wed\0"
+	"Thu\0"
+	"Fri\0"
+	"Sat\0"
+	"May\0"
+	"Jan\0"
+	"Feb\0"
+	"Mar\0"
+	"Apr\0"
+	"Jun\0"
+	"Jul\0"
+	"Aug\0"
+	"Sep\0"
+	"Oct\0"
+	"Nov\0"
+	"Dec\0"
+	"ג\0"
+	"ד\0"
+	"Bo\0"
+	;
+
+static const unsigned short hdate_pool_days[2][2][7] = {
+	{
+		{2546, 2553, 2426, 1964, 2084, 2560, 2093},
+		{2844, 2848, 2852, 2856, 2860, 2864, 2868}
+	},
+	{
+		{1667, 2567, 1678, 1689, 1700, 2102, 2574},
+		{1304, 1156, 2920, 2923, 574, 1491, 2225}
+	}
+};
+
+static const unsigned short hdate_pool_parashaot[2][2][62] = {
+	{
+		{56, 2111, 2721, 1711, 2581, 1559, 2588, 2120, 1722, 2129, 2595, 2138,
+		 2434, 2602, 2727, 2926, 1974, 2733, 1984, 2442, 2147, 2450, 2156, 970,
+		 2458, 2799, 2609, 2616, 1181, 1733, 548, 2804, 2739, 984, 2165, 2745,
+		 1377, 2466, 2623, 2630, 1397, 2474, 2751, 1577, 2482, 1744, 2757, 2763,
+		 2490, 1755, 2498, 2174, 806, 2183, 1159, 961, 1174, 537, 978, 1390,
+		 1571, 797},
+		{56, 2111, 2721, 1711, 2581, 1559, 2588, 2120, 1722, 2129, 2595, 2138,
+		 2434, 2602, 2727, 2926, 1974, 2733, 1984, 2442, 2147, 2450, 2156, 970,
+		 2458, 2799, 2609, 2616, 1181, 1733, 548, 2804, 2739, 984, 2165, 2745,
+		 1377, 2466, 2623, 2630, 1397, 2474, 2751, 1577, 2482, 1744, 2757, 2763,
+		 2490, 1755, 2498, 2174, 806, 2183, 1159, 961, 1174, 537, 978, 1390,
+		 1571, 797}
+	},
+	{
+		{56, 1403, 2809, 1994, 2192, 1279, 1416, 2201, 1766, 2210, 2637, 2219,
+		 2228, 2237, 2246, 2814, 2255, 2264, 1429, 1777, 2273, 1583, 1788, 375,
+		 1799, 2819, 1810, 1821, 397, 1063, 147, 2282, 2644, 584, 1832, 2651,
+		 1442, 1770, 2658, 2665, 1088, 2291, 2300, 844, 1843, 1455, 2672, 2679,
+		 1468, 1595, 1293, 1854, 608, 1481, 557, 364, 386, 131, 577, 1079,
+		 835, 597},
+		{56, 1403, 2809, 1994, 2192, 1279, 1416, 2201, 1766, 2210, 2637, 2219,
+		 2228, 2237, 2246, 2814, 2255, 2264, 1429, 1777, 2273, 1583, 1788, 375,
+		 1799, 2819, 1810, 1821, 397, 1063, 147, 2282, 2644, 584, 1832, 2651,
+		 1442, 1770, 2658, 2665, 1088, 2291, 2300, 844, 1843, 1455, 2672, 2679,
+		 1468, 1595, 1293, 1854, 608, 1481, 557, 364, 386, 131, 577, 1079,
+		 835, 597}
+	}
+};
+
+static const unsigned short hdate_pool_hebrew_months[2][2][14] = {
+	{
+		{2506, 2309, 2686, 1343, 2693, 2824, 2769, 2775, 2781, 1612, 1628, 2829,
+		 2700, 2514},
+		{2506, 2309, 2686, 1343, 2693, 2824, 2769, 2775, 2781, 1612, 1628, 2829,
+		 2700, 2514}
+	},
+	{
+		{2318, 2327, 2336, 261, 1257, 2707, 2345, 2354, 2363, 122, 1154, 2372,
+		 2004, 2014},
+		{2318, 2327, 2336, 261, 1257, 2707, 2345, 2354, 2363, 122, 1154, 2372,
+		 2004, 2014}
+	}
+};
+
+static const unsigned short hdate_pool_gregorian_months[2][12] = {
+	{2522, 2381, 2787, 2793, 2872, 2834, 2839, 2714, 2024, 2530, 2390, 2399},
+	{2876, 2880, 2884, 2888, 2872, 2892, 2896, 2900, 2904, 2908, 2912, 2916}
+};
+
+static const unsigned short hdate_pool_holidays[2][2][37] = {
+	{
+		{1189, 1095, 1307, 1116, 864, 853, 1494, 1321, 2408, 1335, 1865, 1204,
+		 1357, 1349, 882, 871, 1219, 1876, 1507, 1512, 1607, 1619, 2538, 1631,
+		 1363, 995, 1234, 1887, 1643, 1898, 2034, 2044, 1909, 0, 189, 474,
+		 1111},
+		{1189, 1095, 1307, 1116, 864, 853, 1494, 1321, 2408, 1335, 1865, 1204,
+		 1357, 1349, 882, 871, 1219, 1876, 1507, 1512, 1607, 1619, 2538, 1631,
+		 1363, 995, 1234, 1887, 1643, 1898, 2034, 2044, 1909, 0, 197, 479,
+		 1111}
+	},
+	{
+		{2417, 2054, 889, 1657, 178, 495, 2064, 2074, 1920, 1520, 1249, 617,
+		 441, 637, 286, 1012, 408, 1029, 657, 305, 1127, 1931, 1533, 907,
+		 677, 1546, 697, 1942, 318, 1046, 1264, 1953, 717, 516, 57, 216,
+		 1655},
+		{737, 757, 889, 430, 178, 160, 777, 925, 1920, 243, 1249, 617,
+		 441, 637, 286, 268, 408, 1029, 657, 305, 97, 1143, 1533, 907,
+		 677, 452, 697, 943, 318, 293, 341, 816, 717, 516, 57, 216,
+		 1655}
+	}
+};
@@ -30,6 +30,16 @@
 #include "hdate.h"
 #include "support.h"
 
+/* The names of hdate_string are kept in a generated pool, each distinct
+   string once, and looked up by 16 bits offsets. HDATE_NO_STRING_POOL
+   builds the original tables of pointers instead. */
+#ifndef HDATE_NO_STRING_POOL
+#include "hdate_string_pool.h"
+#define HDATE_POOL_STRING(table) ((char *) hdate_string_pool + hdate_pool_##table)
+#else
+#define HDATE_POOL_STRING(table) ((char *) (table))
+#endif
+
 /**
  @brief helper function to find hebrew locale
  
@@ -60,108 +70,320 @@ hdate_is_hebrew_locale()
 	return -1;
 }
 
-/**
- @brief Return a string, with the hebrew date.
+/* Hebrew numerals of the days of the month 1..30, long form with
+   geresh and gershayim, short form without; kept in place rather than
+   by pointers, so the table has no relocations */
+static const char hebrew_day_numbers[2][30][6] = {
+	{
+		"א'", "ב'", "ג'", "ד'", "ה'", "ו'", "ז'", "ח'", "ט'", "י'",
+		"י\"א", "י\"ב", "י\"ג", "י\"ד", "ט\"ו", "ט\"ז", "י\"ז", "י\"ח", "י\"ט", "כ'",
+		"כ\"א", "כ\"ב", "כ\"ג", "כ\"ד", "כ\"ה", "כ\"ו", "כ\"ז", "כ\"ח", "כ\"ט", "ל'",
+	},
+	{
+		"א", "ב", "ג", "ד", "ה", "ו", "ז", "ח", "ט", "י",
+		"יא", "יב", "יג", "יד", "טו", "טז", "יז", "יח", "יט", "כ",
+		"כא", "כב", "כג", "כד", "כה", "כו", "כז", "כח", "כט", "ל",
+	}
+};
+
+/* Hebrew letters are 0xd7 followed by one of these bytes in utf-8;
+   units 1..9, tens 10..90 and hundreds 100..400, 0 for none */
+#define HEBREW_LETTER_LEAD 0xd7
+static const unsigned char hebrew_units[10] =
+	{0, 0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98};
+static const unsigned char hebrew_tens[10] =
+	{0, 0x99, 0x9b, 0x9c, 0x9e, 0xa0, 0xa1, 0xa2, 0xa4, 0xa6};
+static const unsigned char hebrew_hundreds[5] =
+	{0, 0xa7, 0xa8, 0xa9, 0xaa};
 
- @return NULL pointer upon failure or, upon success, a pointer to a
- string containing the short ( e.g. "1 Tishrey" ) or long (e.g. "Tuesday
- 18 Tishrey 5763 Hol hamoed Sukot" ) formated date. You must free() the
- pointer after use.
+/**
+ @brief Write a number as a Hebrew numeral (gematria)
 
- @param h The hdate_struct of the date to print.
- @param diaspora if true give diaspora holydays
- @param short_format A short flag (true - returns a short string, false returns a long string).
+ Days of the month come from a table, other numbers (e.g. years,
+ 5785 is התשפ"ה) are composed letter by letter. Nothing is allocated.
 
- @warning This was originally written using a local static string,
-          calling for output to be copied away.
+ @param buffer at least HEBREW_NUMBER_BUFFER_SIZE bytes
+ @param n The number 1..10999
+ @param short_form A short flag, no geresh and gershayim.
+ @return the length of the string in bytes, 0 if n is out of range
 */
-
-char * hdate_get_format_date (hdate_struct const *h, int const diaspora, int const short_format)
+int
+hdate_format_hebrew_number (char *buffer, int n, int short_form)
 {
-	int hebrew_format	= HDATE_STRING_LOCAL;
-	int omer_day 		= 0;
-	int holiday			= 0;
-	char *bet_h         = "";	// Hebrew prefix for Hebrew month
+	unsigned char letters[8];
+	char const *s;
+	int count = 0;
+	int len = 0;
+	int i;
 
-	char *hebrew_buffer1=0, *hebrew_buffer2=0;
-	int hebrew_buffer1_len = -1;
-	int hebrew_buffer2_len = -1;
-    
-    static char tmp_string[256];
+	short_form = (short_form != 0);
 
-	char *hday_int_str, *hyear_int_str, *omer_str;
+	if (n < 1 || n >= 11000)
+	{
+		buffer[0] = '\0';
+		return 0;
+	}
 
-	if (hdate_is_hebrew_locale())
+	if (n <= 30)
 	{
-		bet_h="ב";
-		hebrew_format = HDATE_STRING_HEBREW;
+		for (s = hebrew_day_numbers[short_form][n - 1]; *s; s++)
+			buffer[len++] = *s;
+		buffer[len] = '\0';
+		return len;
 	}
 
-	hday_int_str = hdate_string(HDATE_STRING_INT, h->hd_day, HDATE_STRING_LONG,hebrew_format);
-	if (hday_int_str == NULL) return NULL;
-	hyear_int_str = hdate_string(HDATE_STRING_INT, h->hd_year, HDATE_STRING_LONG,hebrew_format);
-	if (hyear_int_str == NULL)
+	/* thousands, hundreds, tens and units, 15 and 16 are written 9+6 and 9+7 */
+	if (n >= 10000)
+		letters[count++] = hebrew_tens[1];
+	if (n >= 1000 && (n / 1000) % 10)
+		letters[count++] = hebrew_units[(n / 1000) % 10];
+	n %= 1000;
+	for (; n >= 400; n -= 400)
+		letters[count++] = hebrew_hundreds[4];
+	if (n >= 100)
+		letters[count++] = hebrew_hundreds[n / 100];
+	n %= 100;
+	if (n == 15 || n == 16)
 	{
-		free(hday_int_str);
-		return NULL;
+		letters[count++] = hebrew_units[9];
+		letters[count++] = hebrew_units[n - 9];
+	}
+	else
+	{
+		if (n >= 10)
+			letters[count++] = hebrew_tens[n / 10];
+		if (n % 10)
+			letters[count++] = hebrew_units[n % 10];
+	}
+
+	for (i = 0; i < count; i++)
+	{
+		/* gershayim go before the last letter */
+		if (!short_form && i == count - 1 && count > 1)
+			buffer[len++] = '"';
+		buffer[len++] = (char) HEBREW_LETTER_LEAD;
+		buffer[len++] = (char) letters[i];
+	}
+	if (!short_form && count == 1)
+		buffer[len++] = '\'';
+	buffer[len] = '\0';
+
+	return len;
+}
+
+/**
+ @brief append a string to a buffer, truncating like snprintf
+
+ @param len in: the length so far, out: the length including s,
+            even if it did not fit
+*/
+static void
+hdate_buffer_append (char *buffer, int size, int *len, char const *s)
+{
+	int n = strlen (s);
+	int room = size - 1 - *len;
+
+	if (room > 0)
+	{
+		if (n < room) room = n;
+		memcpy (buffer + *len, s, room);
+		buffer[*len + room] = '\0';
 	}
 
+	*len += n;
+}
+
+/**
+ @brief append a number, in hebrew or decimal form, to a buffer
+
+ @return 0 on success, -1 if the number is out of range
+*/
+static int
+hdate_buffer_append_int (char *buffer, int size, int *len, int n, int hebrew_form)
+{
+	char number[HEBREW_NUMBER_BUFFER_SIZE];
+
+	if (n <= 0 || n >= 11000) return -1;
+
+	if (hebrew_form)
+		hdate_format_hebrew_number (number, n, HDATE_STRING_LONG);
+	else
+		snprintf (number, HEBREW_NUMBER_BUFFER_SIZE, "%d", n);
+
+	hdate_buffer_append (buffer, size, len, number);
+
+	return 0;
+}
+
+/**
+ @brief Write the hebrew date into a buffer, in the given language
+
+ @see hdate_format_date
+*/
+static int
+hdate_format_date_in (int const hebrew_format, hdate_struct const *h, int const diaspora,
+	int const short_format, char *buffer, int const size)
+{
+	int omer_day 		= 0;
+	int holiday			= 0;
+	int len				= 0;
+
+	if (size > 0) buffer[0] = '\0';
+
+	/* day, month and year, e.g. "18 Tishrei 5763" */
+	if (hdate_buffer_append_int (buffer, size, &len, h->hd_day, hebrew_format)) return -1;
+	hdate_buffer_append (buffer, size, &len, " ");
+
+	/* Hebrew prefix for Hebrew month */
+	if (hebrew_format && !short_format)
+		hdate_buffer_append (buffer, size, &len, "ב");
+	hdate_buffer_append (buffer, size, &len,
+			hdate_string (HDATE_STRING_HMONTH, h->hd_mon, HDATE_STRING_LONG, hebrew_format));
+	hdate_buffer_append (buffer, size, &len, " ");
+
+	if (hdate_buffer_append_int (buffer, size, &len, h->hd_year, hebrew_format)) return -1;
+
 	/************************************************************
 	* short format
 	************************************************************/
 	if (short_format)
 	{
-		hebrew_buffer1_len = snprintf(tmp_string, 255, "%s %s %s\n",
-				hday_int_str,
-				hdate_string( HDATE_STRING_HMONTH , h->hd_mon, HDATE_STRING_LONG, hebrew_format),
-				hyear_int_str);
-        strcpy(hebrew_buffer1, tmp_string);
+		hdate_buffer_append (buffer, size, &len, "\n");
+		return len;
 	}
 
-
 	/************************************************************
 	* long (normal) format
 	************************************************************/
-	else
+
+	/* if a day in the omer print it */
+	omer_day = hdate_get_omer_day (h);
+	if (omer_day != 0)
 	{
-		hebrew_buffer1_len = snprintf(tmp_string, 255, "%s %s%s %s",
-				hday_int_str,
-				bet_h,
-				hdate_string( HDATE_STRING_HMONTH , h->hd_mon, HDATE_STRING_LONG, hebrew_format),
-				hyear_int_str);
-        strcpy(hebrew_buffer1, tmp_string);
-
-		/* if a day in the omer print it */
-		if (hebrew_buffer1_len != -1) omer_day = hdate_get_omer_day(h);
-		if (omer_day != 0)
-		{
-			omer_str = hdate_string(HDATE_STRING_OMER, omer_day, HDATE_STRING_LONG, hebrew_format);
-			hebrew_buffer2_len = snprintf(tmp_string, 255, "%s, %s", hebrew_buffer1, omer_str);
-            strcpy(hebrew_buffer2, tmp_string);
-			if (omer_str != NULL) free(omer_str);
-			free(hebrew_buffer1);
-			if (hebrew_buffer2_len != -1) hebrew_buffer1 = hebrew_buffer2;
-			hebrew_buffer1_len = hebrew_buffer2_len;
-		}
-		
-		/* if holiday print it */
-		if (hebrew_buffer1_len != -1) holiday = hdate_get_holyday (h, diaspora);
-		if (holiday != 0)
-		{
-			hebrew_buffer2_len = snprintf(tmp_string, 255, "%s, %s", hebrew_buffer1,
-		  			hdate_string( HDATE_STRING_HOLIDAY, holiday, HDATE_STRING_LONG, hebrew_format));
-            strcpy(hebrew_buffer2, tmp_string);
-			free(hebrew_buffer1);
-			if (hebrew_buffer2_len != -1) hebrew_buffer1 = hebrew_buffer2;
-			hebrew_buffer1_len = hebrew_buffer2_len;
-		}
+		hdate_buffer_append (buffer, size, &len, ", ");
+		hdate_buffer_append_int (buffer, size, &len, omer_day, hebrew_format);
+		hdate_buffer_append (buffer, size, &len, " ");
+		hdate_buffer_append (buffer, size, &len, _("in the Omer"));
+	}
 
+	/* if holiday print it */
+	holiday = hdate_get_holyday (h, diaspora);
+	if (holiday != 0)
+	{
+		hdate_buffer_append (buffer, size, &len, ", ");
+		hdate_buffer_append (buffer, size, &len,
+				hdate_string (HDATE_STRING_HOLIDAY, holiday, HDATE_STRING_LONG, hebrew_format));
 	}
 
-	free(hday_int_str);
-	free(hyear_int_str);
-	if (hebrew_buffer1_len != -1) return hebrew_buffer1;
-	return NULL;
+	return len;
+}
+
+/**
+ @brief Write the hebrew date into a caller supplied buffer.
+
+ Writes in one pass, without allocating, and truncates like snprintf.
+
+ @return the length of the formatted date, not counting the end of
+ string, even if it did not fit in the buffer, or -1 if the day or year
+ of the date can not be formatted.
+
+ @param h The hdate_struct of the date to print.
+ @param diaspora if true give diaspora holydays
+ @param short_format A short flag (true - short string, false long string).
+ @param buffer the output buffer, may be NULL if size is 0
+ @param size the size of the output buffer
+*/
+int
+hdate_format_date (hdate_struct const *h, int const diaspora, int const short_format, char *buffer, int const size)
+{
+	int hebrew_format = HDATE_STRING_LOCAL;
+
+	if (hdate_is_hebrew_locale())
+		hebrew_format = HDATE_STRING_HEBREW;
+
+	return hdate_format_date_in (hebrew_format, h, diaspora, short_format, buffer, size);
+}
+
+/**
+ @brief Set up a formatting context, deciding the language once.
+
+ @param ctx the context to set up
+ @return ctx
+*/
+hdate_fmt_ctx *
+hdate_fmt_ctx_init (hdate_fmt_ctx *ctx)
+{
+#ifdef ENABLE_NLS
+	bindtextdomain (PACKAGE, PACKAGE_LOCALE_DIR);
+	bind_textdomain_codeset (PACKAGE, "UTF-8");
+#endif
+
+	ctx->hebrew_form = hdate_is_hebrew_locale() ? HDATE_STRING_HEBREW : HDATE_STRING_LOCAL;
+	ctx->buffer[0] = '\0';
+
+	return ctx;
+}
+
+/**
+ @brief Format the hebrew date in the scratch space of a context.
+
+ @return a pointer to the formatted date in ctx->buffer, or NULL if the
+ date can not be formatted.
+
+ @param ctx the formatting context
+ @param h The hdate_struct of the date to print.
+ @param diaspora if true give diaspora holydays
+ @param short_format A short flag (true - short string, false long string).
+*/
+char *
+hdate_fmt_date (hdate_fmt_ctx *ctx, hdate_struct const *h, int const diaspora, int const short_format)
+{
+	if (hdate_format_date_in (ctx->hebrew_form, h, diaspora, short_format,
+			ctx->buffer, HDATE_FMT_BUFFER_SIZE) < 0)
+		return NULL;
+
+	return ctx->buffer;
+}
+
+/**
+ @brief Return a string, with the hebrew date.
+
+ @return NULL pointer upon failure or, upon success, a pointer to a
+ string containing the short ( e.g. "1 Tishrey" ) or long (e.g. "Tuesday
+ 18 Tishrey 5763 Hol hamoed Sukot" ) formated date. You must free() the
+ pointer after use.
+
+ @param h The hdate_struct of the date to print.
+ @param diaspora if true give diaspora holydays
+ @param short_format A short flag (true - returns a short string, false returns a long string).
+
+ @see hdate_format_date, for formatting without allocation
+*/
+
+char * hdate_get_format_date (hdate_struct const *h, int const diaspora, int const short_format)
+{
+	char *buffer;
+	int len;
+
+	/* most dates fit, grow once for the long holiday names */
+	buffer = malloc (128);
+	if (buffer == NULL) return NULL;
+
+	len = hdate_format_date (h, diaspora, short_format, buffer, 128);
+	if (len < 0)
+	{
+		free (buffer);
+		return NULL;
+	}
+	if (len >= 128)
+	{
+		free (buffer);
+		buffer = malloc (len + 1);
+		if (buffer == NULL) return NULL;
+		hdate_format_date (h, diaspora, short_format, buffer, len + 1);
+	}
+
+	return buffer;
 }
 
 /**
@@ -241,14 +463,8 @@ char* hdate_string( int const type_of_string, int const index, int const input_s
 	char *h_int_string = NULL;
 	int return_string_len = -1;
 
-	#define H_CHAR_WIDTH 2
-	static char *digits[3][10] = {
-		{" ", "א", "ב", "ג", "ד", "ה", "ו", "ז", "ח", "ט"},
-		{"ט", "י", "כ", "ל", "מ", "נ", "ס", "ע", "פ", "צ"},
-		{" ", "ק", "ר", "ש", "ת"}
-	};
-
-	static char *days[2][2][7] = {
+#ifdef HDATE_NO_STRING_POOL
+	static const char * const days[2][2][7] = {
 		{ // begin english
 		{ // begin english long
 		N_("Sunday"), N_("Monday"), N_("Tuesday"), N_("Wednesday"),
@@ -265,7 +481,7 @@ char* hdate_string( int const type_of_string, int const index, int const input_s
 		}
 		};
 
-	static char *parashaot[2][2][62] = {
+	static const char * const parashaot[2][2][62] = {
 		{ // begin english
 		{ // begin english long
 		 N_("none"),		N_("Bereshit"),		N_("Noach"),
@@ -364,7 +580,7 @@ char* hdate_string( int const type_of_string, int const index, int const input_s
 		}
 		};
 
-	static char *hebrew_months[2][2][14] = {
+	static const char * const hebrew_months[2][2][14] = {
 		{ // begin english
 		{ // begin english long
 		 N_("Tishrei"), N_("Cheshvan"), N_("Kislev"), N_("Tevet"),
@@ -386,7 +602,7 @@ char* hdate_string( int const type_of_string, int const index, int const input_s
 		  "סיון", "תמוז", "אב", "אלול", "אדר א", "אדר ב" }}
 		};
 
-	static char *gregorian_months[2][12] = {
+	static const char * const gregorian_months[2][12] = {
 		{N_("January"), N_("February"), N_("March"),
 		 N_("April"), N_("May"), N_("June"),
 		 N_("July"), N_("August"), N_("September"),
@@ -396,7 +612,7 @@ char* hdate_string( int const type_of_string, int const index, int const input_s
 		 N_("Nov"), N_("Dec")},
 	};
 
-	static char *holidays[2][2][37] = {
+	static const char * const holidays[2][2][37] = {
 		{ // begin english
 		{ // begin english long
 		 N_("Rosh Hashana I"),	N_("Rosh Hashana II"),
@@ -481,8 +697,7 @@ char* hdate_string( int const type_of_string, int const index, int const input_s
 		 "יום הזכרון ליצחק רבין","יום ז\'בוטינסקי",
 		 "עיוה\"כ"}	}
 		};
-    
-    static char tmp_string[256];
+#endif
 
 #ifdef ENABLE_NLS
 	bindtextdomain (PACKAGE, PACKAGE_LOCALE_DIR);
@@ -496,21 +711,21 @@ char* hdate_string( int const type_of_string, int const index, int const input_s
 	switch (type_of_string)
 	{
 	case HDATE_STRING_DOW: if (index >= 1 && index <= 7)
-				return _(days[hebrew_form][short_form][index - 1]);
+				return _(HDATE_POOL_STRING (days[hebrew_form][short_form][index - 1]));
 				break;
 	case HDATE_STRING_PARASHA: if (index >= 1 && index <= 61)
-				return _(parashaot[hebrew_form][short_form][index]);
+				return _(HDATE_POOL_STRING (parashaot[hebrew_form][short_form][index]));
 				break;
 	case HDATE_STRING_HMONTH:
 				if (index >= 1 && index <= 14)
-				return _(hebrew_months[hebrew_form][short_form][index - 1]);
+				return _(HDATE_POOL_STRING (hebrew_months[hebrew_form][short_form][index - 1]));
 				break;
 	case HDATE_STRING_GMONTH:
 				if (index >= 1 && index <= 12)
-				return _(gregorian_months[short_form][index - 1]);
+				return _(HDATE_POOL_STRING (gregorian_months[short_form][index - 1]));
 				break;
 	case HDATE_STRING_HOLIDAY: if (index >= 1 && index <= 37)
-				return _(holidays[hebrew_form][short_form][index - 1]);
+				return _(HDATE_POOL_STRING (holidays[hebrew_form][short_form][index - 1]));
 				break;
 	case HDATE_STRING_OMER:
 				if (index > 0 && index < 50)
@@ -518,8 +733,7 @@ char* hdate_string( int const type_of_string, int const index, int const input_s
 					h_int_string = hdate_string(HDATE_STRING_INT, index, HDATE_STRING_LONG, hebrew_form);
 					if (h_int_string == NULL) return NULL;
 					
-					return_string_len = snprintf(tmp_string, 255, "%s %s", h_int_string, _("in the Omer"));
-                    strcpy(return_string, tmp_string);
+					return_string_len = asprintf(&return_string, "%s %s", h_int_string, _("in the Omer"));
 
 					free(h_int_string);
 
@@ -533,8 +747,7 @@ char* hdate_string( int const type_of_string, int const index, int const input_s
 					// not hebrew form - return the number in decimal form
 					if (!hebrew_form)
 					{
-						return_string_len = snprintf(tmp_string, 255, "%d", index);
-                        strcpy(return_string, tmp_string);
+						return_string_len = asprintf(&return_string, "%d", index);
 						if (return_string_len == -1) return NULL;
 						return return_string;
 					}
@@ -542,50 +755,8 @@ char* hdate_string( int const type_of_string, int const index, int const input_s
 					// HEBREW_NUMBER_BUFFER_SIZE 17	defined in hdate.h
 					return_string = malloc(HEBREW_NUMBER_BUFFER_SIZE);
 					if (return_string == NULL) return NULL;
-					
-					return_string[0] = '\0';
 
-					int n = index;
-
-					if (n >= 1000)
-					{
-						strncat (return_string, digits[0][n / 1000], H_CHAR_WIDTH);
-						n %= 1000;
-					}
-					while (n >= 400)
-					{
-						strncat (return_string, digits[2][4], H_CHAR_WIDTH);
-						n -= 400;
-					}
-					if (n >= 100)
-					{
-						strncat (return_string, digits[2][n / 100], H_CHAR_WIDTH);
-						n %= 100;
-					}
-					if (n >= 10)
-					{
-						if (n == 15 || n == 16)
-							n -= 9;
-						strncat (return_string, digits[1][n / 10], H_CHAR_WIDTH);
-						n %= 10;
-					}
-					if (n > 0)
-						strncat (return_string, digits[0][n], H_CHAR_WIDTH);
-						
-				 	// possibly add the ' and " to hebrew numbers	
-					if (!short_form)
-					{
-						return_string_len = strlen (return_string);
-						if (return_string_len <= H_CHAR_WIDTH) strncat (return_string, "'", H_CHAR_WIDTH);
-						else
-						{
-							return_string[return_string_len + 1] = return_string[return_string_len];
-							return_string[return_string_len] = return_string[return_string_len - 1];
-							return_string[return_string_len - 1] = return_string[return_string_len - 2];
-							return_string[return_string_len - 2] = '\"';
-							return_string[return_string_len + 2] = '\0';
-						}
-					}
+					hdate_format_hebrew_number (return_string, index, short_form);
 					return return_string;
 				}
 				return NULL;
@@ -52,3 +52,18 @@
 #  define _(String) (String)
 #  define N_(String) (String)
 #endif
+
+/*
+ * HDATE_THREAD_LOCAL, for caches kept per thread, so the library can be
+ * used from many threads at once. HDATE_NO_THREAD_LOCAL shares them,
+ * for single threaded builds and compilers without thread storage.
+ */
+#if defined(HDATE_NO_THREAD_LOCAL)
+#  define HDATE_THREAD_LOCAL
+#elif defined(__GNUC__)
+#  define HDATE_THREAD_LOCAL __thread
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+#  define HDATE_THREAD_LOCAL _Thread_local
+#else
+#  define HDATE_THREAD_LOCAL
+#endif
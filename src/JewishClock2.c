@@ -227,10 +227,7 @@ void adjustTimezone(int* time)  // time as minutes since midnight
 //return julian day number for time
 int tm2jd(struct tm *time)
 {
-    int y,m;
-    y = time->tm_year + 1900;
-    m = time->tm_mon + 1;
-    return time->tm_mday-32075+1461*(y+4800+(m-14)/12)/4+367*(m-2-(m-14)/12*12)/12-3*((y+4900+(m-14)/12)/100)/4;
+    return hdate_gdate_to_jd(time->tm_mday, time->tm_mon + 1, time->tm_year + 1900);
 }
 
 int moon_phase(int jdn)
@@ -499,9 +496,22 @@ void updateMoonAndSun() {
     //  sunsetTime = hours2Minutes(calcSunSet(currentPblTime.tm_year, currentPblTime.tm_mon+1, currentPblTime.tm_mday, LATITUDE, LONGITUDE, 91.0f));
     
     APP_LOG(APP_LOG_LEVEL_DEBUG, "SUN CALCULATION with lat=%i lon=%i, timezone=%i", Jlatitude, Jlongitude, Jtimezone);
+    static const int sunRiseSet[] = {HDATE_SUN_RISE, HDATE_SUN_SET};
+    int sunTimes[2];
+#ifdef FIXED_POINT_SUN
+    // Fixed point, the watch has no floating point unit; times can be a minute off the double path
+    // Sun altitudes of the zmanim in thousandths of degrees, add opinions here (e.g. 106100 for alot 16.1 degrees)
+    static const int sunDegrees[] = {90833, 90833};
+    hdate_get_utc_sun_times_fixed(currentPblTime->tm_mday, (currentPblTime->tm_mon)+1, currentPblTime->tm_year + 1900, Jlatitude, Jlongitude, sunDegrees, sunRiseSet, 2, sunTimes);
+#else
     double Dlat=((double)Jlatitude)/1000.0;
     double Dlong = ((double)Jlongitude)/1000.0;
-    hdate_get_utc_sun_time(currentPblTime->tm_mday, (currentPblTime->tm_mon)+1, currentPblTime->tm_year, Dlat, Dlong, &sunriseTime, &sunsetTime);
+    // Sun altitudes of the zmanim, add opinions here (e.g. 106.1 for alot 16.1 degrees)
+    static const double sunDegrees[] = {90.833, 90.833};
+    hdate_get_utc_sun_times(currentPblTime->tm_mday, (currentPblTime->tm_mon)+1, currentPblTime->tm_year + 1900, Dlat, Dlong, sunDegrees, sunRiseSet, 2, sunTimes);
+#endif
+    sunriseTime = sunTimes[0];
+    sunsetTime = sunTimes[1];
 	hatsotTime = (sunriseTime+sunsetTime)/2;
     
     APP_LOG(APP_LOG_LEVEL_DEBUG, "UTC Sunrise=%i, UTC Sunset = %i", sunriseTime, sunsetTime);
@@ -541,7 +551,7 @@ void updateHebrewDate() {
     int hDay, hMonth, hYear, hDayTishrey, hNextTishrey;
     hdate_jd_to_hdate(julianDay, &hDay, &hMonth, &hYear, &hDayTishrey, &hNextTishrey);
     hebrewDayNumber = hDay;
-    char *hebrewMonthName = hdate_get_month_string(hMonth);
+    const char *hebrewMonthName = hdate_get_month_string(hMonth);
     xsprintf(hDayString, "%d",hDay);
     text_layer_set_text(hDayLayer, hDayString);
     text_layer_set_text(hMonthLayer, hebrewMonthName);
@@ -549,7 +559,7 @@ void updateHebrewDate() {
 
 // Update Gregorian Date
 void updateDate() {
-    static char *monthNames[] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+    static const char * const monthNames[] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
     xsprintf(dayString, "%d", currentPblTime->tm_mday);
     xsprintf(monthString, "%s", monthNames[currentPblTime->tm_mon]);
     text_layer_set_text(dayLayer, dayString);
@@ -0,0 +1,91 @@
+/* Generated by tools/gen_new_year_table.c, do not edit */
+
+/* 1 Tishrey of years 5600..6400, one entry per year:
+   (jd_tishrey1 - FIRST_JD - 365 * (year - FIRST_YEAR)) << 4 | year_type */
+#define HDATE_NEW_YEAR_TABLE_FIRST_YEAR 5600
+#define HDATE_NEW_YEAR_TABLE_LAST_YEAR 6400
+#define HDATE_NEW_YEAR_TABLE_FIRST_JD 2392989
+
+static const unsigned short hdate_new_year_table[801] = {
+	0x003c, 0x0171, 0x00b4, 0x000c, 0x0145, 0x00aa, 0x01c4, 0x0115, 0x007a, 0x0194,
+	0x00e5, 0x004e, 0x0182, 0x00cb, 0x01f5, 0x0157, 0x00b9, 0x01d3, 0x0127, 0x008d,
+	0x01c4, 0x0111, 0x005d, 0x0194, 0x00e8, 0x0207, 0x0164, 0x00bc, 0x01f1, 0x0134,
+	0x008c, 0x01c5, 0x012a, 0x0244, 0x0195, 0x00fa, 0x0216, 0x0173, 0x00ce, 0x0207,
+	0x0164, 0x00b8, 0x01d7, 0x0139, 0x0253, 0x01a7, 0x010d, 0x0244, 0x0191, 0x00dd,
+	0x0214, 0x0168, 0x0287, 0x01e4, 0x013c, 0x0271, 0x01b6, 0x011b, 0x0245, 0x01a2,
+	0x00eb, 0x0215, 0x017a, 0x0296, 0x01f3, 0x014e, 0x0287, 0x01e4, 0x0138, 0x0257,
+	0x01b9, 0x02d3, 0x0227, 0x018d, 0x02c4, 0x0211, 0x015d, 0x0294, 0x01e5, 0x014a,
+	0x0264, 0x01bc, 0x02f5, 0x0252, 0x019b, 0x02c5, 0x0227, 0x0189, 0x02a3, 0x01fe,
+	0x0332, 0x0273, 0x01ce, 0x0307, 0x0264, 0x01b8, 0x02d7, 0x0234, 0x018c, 0x02c1,
+	0x020d, 0x0344, 0x0295, 0x01fa, 0x0314, 0x0265, 0x01ca, 0x02e4, 0x023c, 0x0375,
+	0x02d2, 0x021b, 0x0345, 0x02a7, 0x0209, 0x0323, 0x0277, 0x01dd, 0x0314, 0x0268,
+	0x0387, 0x02e4, 0x0238, 0x0357, 0x02b4, 0x020c, 0x0341, 0x028d, 0x03c4, 0x0315,
+	0x027a, 0x0394, 0x02e5, 0x024a, 0x0366, 0x02c3, 0x021e, 0x0352, 0x029b, 0x03c5,
+	0x0327, 0x0289, 0x03a3, 0x02f7, 0x025d, 0x0394, 0x02e8, 0x0407, 0x0364, 0x02b8,
+	0x03d7, 0x0334, 0x028c, 0x03c1, 0x0306, 0x026b, 0x0395, 0x02fa, 0x0414, 0x0365,
+	0x02ce, 0x0402, 0x0343, 0x029e, 0x03d7, 0x0339, 0x0453, 0x03a7, 0x0309, 0x0423,
+	0x0377, 0x02dd, 0x0414, 0x0361, 0x02ad, 0x03e4, 0x033c, 0x0471, 0x03b4, 0x030c,
+	0x0445, 0x03a2, 0x02eb, 0x0415, 0x037a, 0x0496, 0x03f3, 0x034e, 0x0487, 0x03e4,
+	0x0338, 0x0457, 0x03b4, 0x0308, 0x0427, 0x038d, 0x04c4, 0x0411, 0x035d, 0x0494,
+	0x03e5, 0x034a, 0x0464, 0x03bc, 0x04f1, 0x0436, 0x039b, 0x04c5, 0x0422, 0x036b,
+	0x0495, 0x03f7, 0x0359, 0x0473, 0x03ce, 0x0507, 0x0464, 0x03b8, 0x04d7, 0x0434,
+	0x0388, 0x04a7, 0x040d, 0x0544, 0x0491, 0x03dd, 0x0514, 0x0465, 0x03ca, 0x04e4,
+	0x0435, 0x039a, 0x04b6, 0x041b, 0x0545, 0x04a2, 0x03eb, 0x0515, 0x0477, 0x03d9,
+	0x04f3, 0x044e, 0x0587, 0x04e4, 0x0438, 0x0557, 0x04b4, 0x0408, 0x0527, 0x0484,
+	0x03dc, 0x0511, 0x045d, 0x0594, 0x04e5, 0x044a, 0x0564, 0x04b5, 0x041e, 0x0552,
+	0x049b, 0x05c5, 0x0527, 0x0489, 0x05a3, 0x04f7, 0x045d, 0x0594, 0x04e1, 0x042d,
+	0x0564, 0x04b8, 0x05d7, 0x0534, 0x048c, 0x05c1, 0x0504, 0x045c, 0x0595, 0x04fa,
+	0x0614, 0x0565, 0x04ca, 0x05e6, 0x0543, 0x049e, 0x05d7, 0x0534, 0x0488, 0x05a7,
+	0x0509, 0x0623, 0x0577, 0x04dd, 0x0614, 0x0561, 0x04ad, 0x05e4, 0x0538, 0x0657,
+	0x05b4, 0x050c, 0x0641, 0x0586, 0x04eb, 0x0615, 0x0572, 0x04bb, 0x05e5, 0x054a,
+	0x0666, 0x05c3, 0x051e, 0x0657, 0x05b4, 0x0508, 0x0627, 0x0589, 0x06a3, 0x05f7,
+	0x055d, 0x0694, 0x05e1, 0x052d, 0x0664, 0x05b5, 0x051a, 0x0634, 0x058c, 0x06c1,
+	0x0606, 0x056b, 0x0695, 0x05f2, 0x053b, 0x0665, 0x05ce, 0x0702, 0x0643, 0x059e,
+	0x06d7, 0x0634, 0x0588, 0x06a7, 0x0604, 0x055c, 0x0691, 0x05dd, 0x0714, 0x0665,
+	0x05ca, 0x06e4, 0x0635, 0x059a, 0x06b4, 0x060c, 0x0745, 0x06a2, 0x05eb, 0x0715,
+	0x0677, 0x05d9, 0x06f3, 0x0647, 0x05ad, 0x06e4, 0x0638, 0x0757, 0x06b4, 0x0608,
+	0x0727, 0x0684, 0x05dc, 0x0711, 0x065d, 0x0794, 0x06e5, 0x064a, 0x0764, 0x06b5,
+	0x061a, 0x0736, 0x0693, 0x05ee, 0x0722, 0x066b, 0x0795, 0x06f7, 0x0659, 0x0773,
+	0x06c7, 0x062d, 0x0764, 0x06b8, 0x07d7, 0x0734, 0x0688, 0x07a7, 0x0704, 0x065c,
+	0x0791, 0x06d6, 0x063b, 0x0765, 0x06ca, 0x07e4, 0x0735, 0x069e, 0x07d2, 0x0713,
+	0x066e, 0x07a7, 0x0709, 0x0823, 0x0777, 0x06d9, 0x07f3, 0x0747, 0x06ad, 0x07e4,
+	0x0731, 0x067d, 0x07b4, 0x070c, 0x0841, 0x0784, 0x06dc, 0x0815, 0x0772, 0x06bb,
+	0x07e5, 0x074a, 0x0864, 0x07b5, 0x071e, 0x0852, 0x0793, 0x06ee, 0x0827, 0x0784,
+	0x06d8, 0x07f7, 0x075d, 0x0894, 0x07e1, 0x072d, 0x0864, 0x07b5, 0x071a, 0x0834,
+	0x078c, 0x08c1, 0x0806, 0x076b, 0x0895, 0x07f2, 0x073b, 0x0865, 0x07c7, 0x0729,
+	0x0843, 0x079e, 0x08d7, 0x0834, 0x0788, 0x08a7, 0x0804, 0x0758, 0x0877, 0x07dd,
+	0x0914, 0x0861, 0x07ad, 0x08e4, 0x0835, 0x079a, 0x08b4, 0x0805, 0x076a, 0x0886,
+	0x07eb, 0x0915, 0x0872, 0x07bb, 0x08e5, 0x0847, 0x07a9, 0x08c3, 0x081e, 0x0957,
+	0x08b4, 0x0808, 0x0927, 0x0884, 0x07d8, 0x08f7, 0x0854, 0x07ac, 0x08e1, 0x082d,
+	0x0964, 0x08b5, 0x081a, 0x0934, 0x0885, 0x07ee, 0x0922, 0x086b, 0x0995, 0x08f7,
+	0x0859, 0x0973, 0x08c7, 0x0829, 0x0943, 0x0897, 0x07fd, 0x0934, 0x0888, 0x09a7,
+	0x0904, 0x085c, 0x0991, 0x08d4, 0x082c, 0x0965, 0x08ca, 0x09e4, 0x0935, 0x089a,
+	0x09b6, 0x0913, 0x086e, 0x09a7, 0x0904, 0x0858, 0x0977, 0x08d9, 0x09f3, 0x0947,
+	0x08ad, 0x09e4, 0x0931, 0x087d, 0x09b4, 0x0908, 0x0a27, 0x0984, 0x08dc, 0x0a11,
+	0x0956, 0x08bb, 0x09e5, 0x0942, 0x088b, 0x09b5, 0x091a, 0x0a36, 0x0993, 0x08ee,
+	0x0a27, 0x0984, 0x08d8, 0x09f7, 0x0959, 0x0a73, 0x09c7, 0x092d, 0x0a64, 0x09b1,
+	0x08fd, 0x0a34, 0x0985, 0x08ea, 0x0a04, 0x095c, 0x0a91, 0x09d6, 0x093b, 0x0a65,
+	0x09c2, 0x090b, 0x0a35, 0x099e, 0x0ad2, 0x0a13, 0x096e, 0x0aa7, 0x0a04, 0x0958,
+	0x0a77, 0x09d4, 0x092c, 0x0a61, 0x09ad, 0x0ae4, 0x0a35, 0x099a, 0x0ab4, 0x0a05,
+	0x096a, 0x0a84, 0x09dc, 0x0b15, 0x0a72, 0x09bb, 0x0ae5, 0x0a47, 0x09a9, 0x0ac3,
+	0x0a17, 0x097d, 0x0ab4, 0x0a08, 0x0b27, 0x0a84, 0x09d8, 0x0af7, 0x0a54, 0x09ac,
+	0x0ae1, 0x0a2d, 0x0b64, 0x0ab5, 0x0a1a, 0x0b34, 0x0a85, 0x09ea, 0x0b06, 0x0a63,
+	0x09be, 0x0af2, 0x0a3b, 0x0b65, 0x0ac7, 0x0a29, 0x0b43, 0x0a97, 0x09fd, 0x0b34,
+	0x0a88, 0x0ba7, 0x0b04, 0x0a58, 0x0b77, 0x0ad4, 0x0a2c, 0x0b61, 0x0aa6, 0x0a0b,
+	0x0b35, 0x0a9a, 0x0bb4, 0x0b05, 0x0a6a, 0x0b86, 0x0ae3, 0x0a3e, 0x0b72, 0x0abb,
+	0x0be5, 0x0b47, 0x0aa9, 0x0bc3, 0x0b17, 0x0a7d, 0x0bb4, 0x0b01, 0x0a4d, 0x0b84,
+	0x0adc, 0x0c11, 0x0b54, 0x0aac, 0x0be5, 0x0b42, 0x0a8b, 0x0bb5, 0x0b1a, 0x0c34,
+	0x0b85, 0x0aee, 0x0c22, 0x0b63, 0x0abe, 0x0bf7, 0x0b54, 0x0aa8, 0x0bc7, 0x0b2d,
+	0x0c64, 0x0bb1, 0x0afd, 0x0c34, 0x0b85, 0x0aea, 0x0c04, 0x0b5c, 0x0c91, 0x0bd4,
+	0x0b2c, 0x0c65, 0x0bc2, 0x0b0b, 0x0c35, 0x0b97, 0x0af9, 0x0c13, 0x0b6e, 0x0ca7,
+	0x0c04, 0x0b58, 0x0c77, 0x0bd4, 0x0b28, 0x0c47, 0x0bad, 0x0ce4, 0x0c31, 0x0b7d,
+	0x0cb4, 0x0c05, 0x0b6a, 0x0c84, 0x0bd5, 0x0b3a, 0x0c56, 0x0bbb, 0x0ce5, 0x0c42,
+	0x0b8b, 0x0cb5, 0x0c17, 0x0b79, 0x0c93, 0x0bee, 0x0d27, 0x0c84, 0x0bd8, 0x0cf7,
+	0x0c54, 0x0ba8, 0x0cc7, 0x0c24, 0x0b7c, 0x0cb1, 0x0bfd, 0x0d34, 0x0c85, 0x0bea,
+	0x0d04, 0x0c55, 0x0bbe, 0x0cf2, 0x0c3b, 0x0d65, 0x0cc7, 0x0c29, 0x0d43, 0x0c97,
+	0x0bf9, 0x0d13, 0x0c67, 0x0bcd, 0x0d04, 0x0c58, 0x0d77, 0x0cd4, 0x0c2c, 0x0d61,
+	0x0ca4, 0x0bfc, 0x0d35, 0x0c9a, 0x0db4, 0x0d05, 0x0c6a, 0x0d86, 0x0ce3, 0x0c3e,
+	0x0d77, 0x0cd4, 0x0c28, 0x0d47, 0x0ca9, 0x0dc3, 0x0d17, 0x0c7d, 0x0db4, 0x0d01,
+	0x0c4d, 0x0d84, 0x0cd8, 0x0df7, 0x0d54, 0x0cac, 0x0de1, 0x0d26, 0x0c8b, 0x0db5,
+	0x0d12
+};
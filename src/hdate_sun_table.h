@@ -0,0 +1,71 @@
+/* Generated by tools/gen_sun_table.c, do not edit */
+
+/* Sun declination and equation of time of each day of the year,
+   by [day_of_year - 1]: {declination * HDATE_SUN_TABLE_DECL_ONE (radians),
+   eqtime * HDATE_SUN_TABLE_EQTIME_ONE (minutes)} */
+#define HDATE_SUN_TABLE_DECL_ONE 32768
+#define HDATE_SUN_TABLE_EQTIME_ONE 1024
+
+static const short hdate_sun_table[366][2] = {
+	{-13187, -2974}, {-13142, -3431}, {-13092, -3885}, {-13038, -4333}, {-12980, -4776}, {-12917, -5214},
+	{-12850, -5646}, {-12779, -6071}, {-12704, -6489}, {-12625, -6901}, {-12541, -7304}, {-12453, -7700},
+	{-12362, -8087}, {-12266, -8466}, {-12166, -8836}, {-12062, -9197}, {-11955, -9548}, {-11844, -9889},
+	{-11729, -10220}, {-11610, -10541}, {-11487, -10850}, {-11361, -11149}, {-11232, -11437}, {-11098, -11713},
+	{-10962, -11977}, {-10822, -12230}, {-10679, -12470}, {-10532, -12699}, {-10382, -12914}, {-10229, -13118},
+	{-10073, -13308}, {-9914, -13486}, {-9752, -13651}, {-9587, -13802}, {-9420, -13941}, {-9249, -14066},
+	{-9076, -14179}, {-8900, -14277}, {-8722, -14363}, {-8541, -14436}, {-8358, -14495}, {-8172, -14541},
+	{-7984, -14573}, {-7794, -14593}, {-7602, -14599}, {-7408, -14593}, {-7211, -14573}, {-7013, -14541},
+	{-6813, -14496}, {-6611, -14438}, {-6407, -14368}, {-6202, -14286}, {-5995, -14192}, {-5786, -14086},
+	{-5576, -13968}, {-5365, -13839}, {-5152, -13698}, {-4938, -13547}, {-4723, -13385}, {-4506, -13212},
+	{-4289, -13030}, {-4070, -12837}, {-3851, -12635}, {-3631, -12423}, {-3410, -12202}, {-3188, -11973},
+	{-2965, -11735}, {-2742, -11489}, {-2519, -11236}, {-2294, -10975}, {-2070, -10708}, {-1845, -10433},
+	{-1619, -10153}, {-1394, -9866}, {-1168, -9574}, {-942, -9277}, {-716, -8976}, {-490, -8670},
+	{-264, -8360}, {-38, -8047}, {188, -7730}, {414, -7411}, {639, -7090}, {864, -6766},
+	{1089, -6442}, {1313, -6116}, {1537, -5789}, {1760, -5463}, {1983, -5136}, {2205, -4810},
+	{2426, -4485}, {2647, -4161}, {2867, -3839}, {3086, -3519}, {3304, -3202}, {3521, -2887},
+	{3737, -2576}, {3952, -2268}, {4165, -1965}, {4378, -1666}, {4590, -1371}, {4800, -1081},
+	{5009, -797}, {5216, -519}, {5422, -246}, {5627, 20}, {5830, 280}, {6031, 532},
+	{6231, 778}, {6429, 1016}, {6625, 1247}, {6820, 1469}, {7012, 1683}, {7203, 1889},
+	{7392, 2087}, {7579, 2276}, {7764, 2455}, {7946, 2626}, {8127, 2787}, {8305, 2939},
+	{8481, 3081}, {8655, 3213}, {8826, 3336}, {8995, 3449}, {9161, 3551}, {9325, 3644},
+	{9487, 3727}, {9645, 3799}, {9802, 3862}, {9955, 3914}, {10106, 3956}, {10253, 3987},
+	{10398, 4009}, {10540, 4021}, {10680, 4022}, {10816, 4014}, {10949, 3995}, {11079, 3967},
+	{11206, 3929}, {11330, 3882}, {11450, 3825}, {11567, 3759}, {11681, 3684}, {11792, 3600},
+	{11899, 3507}, {12003, 3405}, {12104, 3296}, {12201, 3178}, {12294, 3052}, {12384, 2918},
+	{12470, 2777}, {12553, 2629}, {12632, 2474}, {12707, 2313}, {12779, 2145}, {12847, 1971},
+	{12911, 1792}, {12972, 1607}, {13029, 1417}, {13081, 1222}, {13130, 1022}, {13176, 819},
+	{13217, 612}, {13254, 402}, {13288, 188}, {13317, -28}, {13343, -246}, {13365, -467},
+	{13383, -689}, {13397, -912}, {13406, -1136}, {13412, -1360}, {13414, -1585}, {13413, -1809},
+	{13407, -2032}, {13397, -2255}, {13383, -2475}, {13365, -2695}, {13344, -2912}, {13318, -3126},
+	{13289, -3337}, {13255, -3545}, {13218, -3750}, {13177, -3950}, {13132, -4146}, {13083, -4338},
+	{13031, -4524}, {12974, -4705}, {12914, -4880}, {12850, -5049}, {12783, -5212}, {12711, -5368},
+	{12636, -5517}, {12558, -5659}, {12476, -5793}, {12390, -5920}, {12301, -6038}, {12208, -6148},
+	{12111, -6250}, {12012, -6342}, {11909, -6426}, {11802, -6500}, {11693, -6565}, {11580, -6621},
+	{11463, -6666}, {11344, -6702}, {11221, -6727}, {11096, -6742}, {10967, -6747}, {10835, -6741},
+	{10700, -6724}, {10563, -6697}, {10422, -6659}, {10279, -6611}, {10133, -6551}, {9984, -6481},
+	{9832, -6399}, {9678, -6307}, {9521, -6204}, {9362, -6089}, {9200, -5964}, {9035, -5829},
+	{8869, -5682}, {8699, -5525}, {8528, -5357}, {8354, -5179}, {8179, -4990}, {8001, -4791},
+	{7821, -4583}, {7638, -4364}, {7454, -4135}, {7268, -3897}, {7080, -3650}, {6890, -3394},
+	{6699, -3128}, {6506, -2854}, {6310, -2572}, {6114, -2281}, {5916, -1983}, {5716, -1677},
+	{5514, -1363}, {5312, -1043}, {5107, -716}, {4902, -382}, {4695, -42}, {4487, 303},
+	{4278, 654}, {4068, 1009}, {3856, 1370}, {3644, 1734}, {3430, 2103}, {3216, 2475},
+	{3000, 2850}, {2784, 3228}, {2567, 3608}, {2349, 3990}, {2131, 4374}, {1912, 4758},
+	{1692, 5144}, {1472, 5529}, {1251, 5915}, {1030, 6300}, {809, 6684}, {587, 7066},
+	{365, 7447}, {142, 7825}, {-80, 8201}, {-303, 8574}, {-526, 8943}, {-749, 9308},
+	{-971, 9669}, {-1194, 10024}, {-1417, 10375}, {-1639, 10720}, {-1861, 11059}, {-2083, 11392},
+	{-2304, 11718}, {-2525, 12037}, {-2746, 12348}, {-2966, 12652}, {-3185, 12947}, {-3404, 13233},
+	{-3622, 13511}, {-3839, 13779}, {-4056, 14037}, {-4272, 14286}, {-4486, 14524}, {-4700, 14752},
+	{-4912, 14969}, {-5124, 15174}, {-5334, 15369}, {-5543, 15551}, {-5751, 15722}, {-5957, 15881},
+	{-6162, 16027}, {-6365, 16161}, {-6567, 16282}, {-6767, 16390}, {-6965, 16485}, {-7161, 16566},
+	{-7356, 16635}, {-7549, 16690}, {-7740, 16731}, {-7928, 16758}, {-8115, 16772}, {-8299, 16772},
+	{-8482, 16758}, {-8661, 16730}, {-8839, 16688}, {-9014, 16632}, {-9186, 16562}, {-9356, 16478},
+	{-9524, 16381}, {-9688, 16269}, {-9850, 16144}, {-10009, 16004}, {-10165, 15852}, {-10318, 15685},
+	{-10468, 15506}, {-10615, 15313}, {-10758, 15107}, {-10899, 14888}, {-11036, 14656}, {-11170, 14412},
+	{-11300, 14155}, {-11427, 13887}, {-11551, 13606}, {-11671, 13314}, {-11787, 13010}, {-11899, 12696},
+	{-12008, 12370}, {-12113, 12034}, {-12215, 11688}, {-12312, 11332}, {-12405, 10966}, {-12495, 10591},
+	{-12580, 10207}, {-12662, 9815}, {-12739, 9414}, {-12812, 9006}, {-12881, 8590}, {-12946, 8167},
+	{-13006, 7738}, {-13063, 7302}, {-13115, 6861}, {-13162, 6414}, {-13206, 5963}, {-13245, 5506},
+	{-13279, 5046}, {-13310, 4582}, {-13335, 4115}, {-13357, 3645}, {-13374, 3172}, {-13386, 2698},
+	{-13394, 2223}, {-13398, 1746}, {-13397, 1269}, {-13391, 792}, {-13381, 315}, {-13367, -161},
+	{-13348, -636}, {-13325, -1108}, {-13297, -1579}, {-13265, -2047}, {-13228, -2512}, {-13187, -2974}
+};
@@ -31,8 +31,15 @@
 //#include "support.h"
 
 #include "hdate_sun_time.h"
+#include "hebrewdate.h"
 #include "my_math.h"
 
+/* The declination and the equation of time only depend on the day of
+   year, they are read from a generated table of fixed point values
+   instead of the series. HDATE_NO_SUN_TABLE builds the series (the
+   fixed point functions always read the table). */
+#include "hdate_sun_table.h"
+
 /**
  @brief days from 1 january
   
@@ -44,91 +51,780 @@
 int
 hdate_get_day_of_year (int day, int month, int year)
 {
-	int jd;
-	
-	/* get todays julian day number */
-	jd = (1461 * (year + 4800 + (month - 14) / 12)) / 4 +
-		(367 * (month - 2 - 12 * ((month - 14) / 12))) / 12 -
-		(3 * ((year + 4900 + (month - 14) / 12) / 100)) / 4 + day;
-	
-	/* substruct the julian day of 1/1/year and add one */
-	jd = jd - ((1461 * (year + 4799)) / 4 +
-		367 * 11 / 12 - (3 * ((year + 4899) / 100)) / 4);
-
-	return jd;
+	/* todays julian day number less the one of 1/1/year, plus one */
+	return hdate_gdate_to_jd (day, month, year) - hdate_gdate_to_jd (1, 1, year) + 1;
 }
 
 /**
- @brief utc sun times for altitude at a gregorian date
+ @brief sun ephemeris of a gregorian date
 
- Returns the sunset and sunrise times in minutes from 00:00 (utc time)
- if sun altitude in sunrise is deg degries.
- This function only works for altitudes sun realy is.
- If the sun never get to this altitude, the returned sunset and sunrise values 
- will be negative. This can happen in low altitude when latitude is 
- nearing the pols in winter times, the sun never goes very high in 
- the sky there.
+ Computes the date dependent part of the sun times once, so the times of
+ several sun altitudes (see hdate_get_utc_sun_time_eph) can share it.
 
  @param day this day of month
  @param month this month
  @param year this year
- @param longitude longitude to use in calculations
- @param latitude latitude to use in calculations
- @param deg degrees of sun's altitude (0 -  Zenith .. 90 - Horizon)
- @param sunrise return the utc sunrise in minutes
- @param sunset return the utc sunset in minutes
+ @param eph return the sun ephemeris of this date
 */
 void
-hdate_get_utc_sun_time_deg (int day, int month, int year, double latitude, double longitude, double deg, int *sunrise, int *sunset)
+hdate_get_sun_ephemeris (int day, int month, int year, hdate_sun_ephemeris *eph)
 {
 	double gama; /* location of sun in yearly cycle in radians */
-	double eqtime; /* diffference betwen sun noon and clock noon */
-	double decl; /* sun declanation */
-	double ha; /* solar hour engle */
-	double sunrise_angle = M_PI * deg / 180.0; /* sun angle at sunrise/set */
+	double sin_gama, cos_gama;
+	double sin_2gama, cos_2gama;
+	double sin_3gama, cos_3gama;
 	
 	int day_of_year;
 	
 	/* get the day of year */
 	day_of_year = hdate_get_day_of_year (day, month, year);
 	
+#ifndef HDATE_NO_SUN_TABLE
+	if (day_of_year >= 1 && day_of_year <= 366)
+	{
+		double decl2;
+		
+		eph->decl = (double) hdate_sun_table[day_of_year - 1][0] / HDATE_SUN_TABLE_DECL_ONE;
+		eph->eqtime = (double) hdate_sun_table[day_of_year - 1][1] / HDATE_SUN_TABLE_EQTIME_ONE;
+		
+		/* |decl| < 0.41, so a few Taylor terms are exact to 1e-7 */
+		decl2 = eph->decl * eph->decl;
+		eph->sin_decl = eph->decl * (1.0 - decl2 / 6.0 * (1.0 - decl2 / 20.0 * (1.0 - decl2 / 42.0)));
+		eph->cos_decl = 1.0 - decl2 / 2.0 * (1.0 - decl2 / 12.0 * (1.0 - decl2 / 30.0));
+		
+		return;
+	}
+#endif
+	
 	/* get radians of sun orbit around erth =) */
 	gama = 2.0 * M_PI * ((double)(day_of_year - 1) / 365.0);
 	
+	/* the multiples of gama from the double and triple angle formulas */
+	sin_gama = my_sin (gama);
+	cos_gama = my_cos (gama);
+	sin_2gama = 2.0 * sin_gama * cos_gama;
+	cos_2gama = 2.0 * cos_gama * cos_gama - 1.0;
+	sin_3gama = sin_gama * (3.0 - 4.0 * sin_gama * sin_gama);
+	cos_3gama = cos_gama * (4.0 * cos_gama * cos_gama - 3.0);
+	
 	/* get the diff betwen suns clock and wall clock in minutes */
-	eqtime = 229.18 * (0.000075 + 0.001868 * my_cos(gama)
-		- 0.032077 * my_sin(gama) - 0.014615 * my_cos (2.0 * gama)
-		- 0.040849 * my_sin (2.0 * gama));
+	eph->eqtime = 229.18 * (0.000075 + 0.001868 * cos_gama
+		- 0.032077 * sin_gama - 0.014615 * cos_2gama
+		- 0.040849 * sin_2gama);
 	
 	/* calculate suns declanation at the equater in radians */
-	decl = 0.006918 - 0.399912 * my_cos (gama) + 0.070257 * my_sin (gama)
-		- 0.006758 * my_cos (2.0 * gama) + 0.000907 * my_sin (2.0 * gama)
-		- 0.002697 * my_cos (3.0 * gama) + 0.00148 * my_sin (3.0 * gama);
+	eph->decl = 0.006918 - 0.399912 * cos_gama + 0.070257 * sin_gama
+		- 0.006758 * cos_2gama + 0.000907 * sin_2gama
+		- 0.002697 * cos_3gama + 0.00148 * sin_3gama;
+	
+	eph->sin_decl = my_sin (eph->decl);
+	eph->cos_decl = my_cos (eph->decl);
+	
+	return;
+}
+
+/**
+ @brief utc sun times for altitude, from the sun ephemeris and the latitude trig
+
+ @param eph sun ephemeris of the date
+ @param sin_latitude sine of the latitude
+ @param cos_latitude cosine of the latitude
+ @param longitude longitude to use in calculations
+ @param deg degrees of sun's altitude (0 -  Zenith .. 90 - Horizon)
+ @param sunrise return the utc sunrise in minutes
+ @param sunset return the utc sunset in minutes
+*/
+static void
+hdate_get_utc_sun_time_trig (hdate_sun_ephemeris const *eph, double sin_latitude, double cos_latitude,
+	double longitude, double deg, int *sunrise, int *sunset)
+{
+	double ha; /* solar hour engle */
+	double noon; /* sun noon in utc minutes */
+	
+	/* the sun real time diff from noon at sunset/rise in radians,
+	   cos ha = (cos deg - sin lat sin decl) / (cos lat cos decl) */
+	ha = my_acos ((my_cos (M_PI * deg / 180.0) - sin_latitude * eph->sin_decl) /
+		(cos_latitude * eph->cos_decl));
 	
+	/* we use minutes, ratio is 1440min/2pi */
+	ha = 720.0 * ha / M_PI;
+	
+	/* get sunset/rise times in utc wall clock in minutes from 00:00 time */
+	noon = 720.0 - 4.0 * longitude - eph->eqtime;
+	*sunrise = (int)(noon - ha);
+	*sunset = (int)(noon + ha);
+	
+	return;
+}
+
+/**
+ @brief utc sun times for altitude, from the sun ephemeris of the date
+
+ @see hdate_get_utc_sun_time_deg
+
+ @param eph sun ephemeris of the date (see hdate_get_sun_ephemeris)
+ @param latitude latitude to use in calculations
+ @param longitude longitude to use in calculations
+ @param deg degrees of sun's altitude (0 -  Zenith .. 90 - Horizon)
+ @param sunrise return the utc sunrise in minutes
+ @param sunset return the utc sunset in minutes
+*/
+void
+hdate_get_utc_sun_time_eph (hdate_sun_ephemeris const *eph, double latitude, double longitude, double deg, int *sunrise, int *sunset)
+{
 	/* we use radians, ratio is 2pi/360 */
 	latitude = M_PI * latitude / 180.0;
 	
-	/* the sun real time diff from noon at sunset/rise in radians */
-//	errno = 0;
-	ha = my_acos (my_cos (sunrise_angle) / (my_cos (latitude) * my_cos (decl)) - my_tan (latitude) * my_tan (decl));
+	hdate_get_utc_sun_time_trig (eph, my_sin (latitude), my_cos (latitude), longitude, deg, sunrise, sunset);
 	
-	/* check for too high altitudes and return negative values */
-/*
-	if (errno == EDOM)
+	return;
+}
+
+/**
+ @brief utc sun times of several altitudes, from the sun ephemeris of the date
+
+ @see hdate_get_utc_sun_times
+
+ @param eph sun ephemeris of the date (see hdate_get_sun_ephemeris)
+ @param latitude latitude to use in calculations
+ @param longitude longitude to use in calculations
+ @param deg degrees of sun's altitude of each time (0 -  Zenith .. 90 - Horizon)
+ @param rise_set HDATE_SUN_RISE or HDATE_SUN_SET for each time
+ @param count number of times
+ @param times return the utc time of each altitude in minutes
+*/
+void
+hdate_get_utc_sun_times_eph (hdate_sun_ephemeris const *eph, double latitude, double longitude,
+	double const deg[], int const rise_set[], int count, int times[])
+{
+	double sin_latitude, cos_latitude;
+	int sunrise = 0, sunset = 0;
+	int i;
+	
+	/* the latitude is the same for all the angles */
+	latitude = M_PI * latitude / 180.0;
+	sin_latitude = my_sin (latitude);
+	cos_latitude = my_cos (latitude);
+	
+	for (i = 0; i < count; i++)
 	{
-		*sunrise = -720;
-		*sunset = -720;
+		/* rise and set of the same altitude share the hour angle */
+		if (i == 0 || deg[i] != deg[i - 1])
+			hdate_get_utc_sun_time_trig (eph, sin_latitude, cos_latitude, longitude, deg[i], &sunrise, &sunset);
 		
-		return;
+		times[i] = (rise_set[i] == HDATE_SUN_SET) ? sunset : sunrise;
+	}
+	
+	return;
+}
+
+/* Fixed point sun times, for targets without a floating point unit:
+   sines and cosines are Q30 (1 << 30 is one), angles are binary angles
+   (1 << 32 is a full turn) and times are Q16 minutes. The ephemeris is
+   read from the day of year table. */
+#define HDATE_FIXED_ONE (1 << 30)
+#define HDATE_FIXED_QUARTER_TURN 0x40000000u
+#define HDATE_FIXED_TURN_PER_RADIAN 683565276LL /* (1 << 32) / 2pi */
+#define HDATE_FIXED_MINUTES_PER_RADIAN 15019745LL /* 720 / pi, Q16 */
+#define HDATE_FIXED_PI 1686629713 /* pi, Q29 */
+
+/**
+ @brief binary angle of thousandths of a degree
+*/
+static unsigned int
+hdate_fixed_angle (int mdeg)
+{
+	/* mdeg * 2^32 / 360000 as a multiply and shift, 2^49 / 360000 rounded */
+	return (unsigned int) ((long long) mdeg * 1563749871 >> 17);
+}
+
+/**
+ @brief sine of a binary angle, Q30
+*/
+static int
+hdate_fixed_sin (unsigned int angle)
+{
+	/* odd polynomial of sin (pi t / 2) on the quarter turn, error 4e-9 */
+	static const int c[5] = {1686629674, -693597884, 85564887, -5016813, 161965};
+	int t = angle & (HDATE_FIXED_QUARTER_TURN - 1);
+	long long t2;
+	long long p;
+	
+	/* second and fourth quarters mirror the first and third */
+	if (angle & HDATE_FIXED_QUARTER_TURN)
+		t = HDATE_FIXED_QUARTER_TURN - t;
+	
+	t2 = (long long) t * t >> 30;
+	p = c[4];
+	p = c[3] + (p * t2 >> 30);
+	p = c[2] + (p * t2 >> 30);
+	p = c[1] + (p * t2 >> 30);
+	p = c[0] + (p * t2 >> 30);
+	p = p * t >> 30;
+	
+	/* third and fourth quarters are negative */
+	return (angle & (2 * HDATE_FIXED_QUARTER_TURN)) ? (int) -p : (int) p;
+}
+
+/**
+ @brief cosine of a binary angle, Q30
+*/
+static int
+hdate_fixed_cos (unsigned int angle)
+{
+	return hdate_fixed_sin (angle + HDATE_FIXED_QUARTER_TURN);
+}
+
+/**
+ @brief integer square root, rounded down
+*/
+static unsigned int
+hdate_fixed_sqrt (unsigned long long x)
+{
+	unsigned long long root = 0;
+	unsigned long long bit = 1ULL << 62;
+	unsigned long long mask;
+	
+	while (bit > x)
+		bit >>= 2;
+	
+	/* the bits of the root come out as masks, without branches */
+	for (; bit; bit >>= 2)
+	{
+		mask = -(unsigned long long) (x >= root + bit);
+		x -= (root + bit) & mask;
+		root = (root >> 1) + (bit & mask);
 	}
+	
+	return (unsigned int) root;
+}
+
+/**
+ @brief arc cosine of a Q30 value in -1..1, Q29 radians
 */
+static int
+hdate_fixed_acos (int x)
+{
+	/* acos x = sqrt (1 - x) P(x) for 0 <= x <= 1, error 2e-8
+	   (Abramowitz and Stegun 4.4.46) */
+	static const int a[8] = {1686629690, -230423709, 95540460, -53874249,
+		33169905, -18348235, 7161955, -1355589};
+	int xa = (x < 0) ? -x : x;
+	long long p;
+	int i;
 	
-	/* we use minutes, ratio is 1440min/2pi */
-	ha = 720.0 * ha / M_PI;
+	p = a[7];
+	for (i = 6; i >= 0; i--)
+		p = a[i] + (p * xa >> 30);
 	
-	/* get sunset/rise times in utc wall clock in minutes from 00:00 time */
-	*sunrise = (int)(720.0 - 4.0 * longitude - ha - eqtime);
-	*sunset = (int)(720.0 - 4.0 * longitude + ha - eqtime);
+	/* sqrt (1 - x) is Q30 as the root of a Q60 value, the product Q29 */
+	p = p * hdate_fixed_sqrt ((unsigned long long) (HDATE_FIXED_ONE - xa) << 30) >> 31;
+	
+	/* acos (-x) = pi - acos (x) */
+	return (x < 0) ? HDATE_FIXED_PI - (int) p : (int) p;
+}
+
+/**
+ @brief reciprocal of a 32 bits value, about 2^62 / d for 2^31 <= d < 2^32
+
+ A 32 bits division gives 16 bits of the reciprocal, a Newton step
+ (multiplications only) the rest, so targets without a 64 bits divide
+ need no library routine.
+*/
+static int
+hdate_fixed_reciprocal (unsigned int d)
+{
+	long long r;
+	long long e;
+	
+	/* 2^48 / d from the high half of d, good to about 2^-15 */
+	r = (long long) (0xffffffffu / (d >> 16)) << 14;
+	
+	/* r (2 - d r / 2^62), the error of r scaled to fit the product */
+	e = (1LL << 62) - (long long) ((unsigned long long) d * (unsigned long long) r);
+	r += (e >> 16) * r >> 46;
+	
+	return (r > 0x7fffffff) ? 0x7fffffff : (int) r;
+}
+
+/** @struct hdate_sun_fixed
+ @brief date and place part of the fixed point sun times
+ */
+typedef struct
+{
+	/** Sine of the latitude times sine of the declination, Q30. */
+	int sin_latitude_decl;
+	/** Cosine of the latitude times cosine of the declination, Q30. */
+	int cos_latitude_decl;
+	/** Reciprocal of cos_latitude_decl << recip_shift (see hdate_fixed_reciprocal). */
+	int recip;
+	/** Shift that brings cos_latitude_decl to 2^31 .. 2^32. */
+	int recip_shift;
+	/** Sun noon in utc Q16 minutes. */
+	int noon;
+} hdate_sun_fixed;
+
+/**
+ @brief date and place part of the fixed point sun times
+
+ @param day this day of month
+ @param month this month
+ @param year this year
+ @param latitude latitude in thousandths of a degree
+ @param longitude longitude in thousandths of a degree
+ @param sun return the date and place part
+*/
+static void
+hdate_get_sun_fixed (int day, int month, int year, int latitude, int longitude, hdate_sun_fixed *sun)
+{
+	int day_of_year;
+	unsigned int decl;
+	unsigned int d;
+	
+	/* the ephemeris of the day from the table */
+	day_of_year = hdate_get_day_of_year (day, month, year);
+	if (day_of_year < 1)
+		day_of_year = 1;
+	if (day_of_year > 366)
+		day_of_year = 366;
+	decl = (unsigned int) (hdate_sun_table[day_of_year - 1][0] * HDATE_FIXED_TURN_PER_RADIAN /
+		HDATE_SUN_TABLE_DECL_ONE);
+	
+	/* the date and latitude parts of cos ha */
+	sun->sin_latitude_decl = (int) ((long long) hdate_fixed_sin (hdate_fixed_angle (latitude)) * hdate_fixed_sin (decl) >> 30);
+	sun->cos_latitude_decl = (int) ((long long) hdate_fixed_cos (hdate_fixed_angle (latitude)) * hdate_fixed_cos (decl) >> 30);
+	
+	/* the hour angles divide by cos_latitude_decl, take its reciprocal
+	   once; it is 0 at the poles, where the hour angles are clamped */
+	sun->recip = 0;
+	sun->recip_shift = 0;
+	if (sun->cos_latitude_decl > 0)
+	{
+		for (d = (unsigned int) sun->cos_latitude_decl; !(d & 0x80000000u); d <<= 1)
+			sun->recip_shift++;
+		sun->recip = hdate_fixed_reciprocal (d);
+	}
+	
+	/* longitude * (4 << 16) / 1000 as a multiply and shift, 2^22 * 262.144 rounded */
+	sun->noon = (720 << 16) - (int) ((long long) longitude * 1099511628 >> 22) -
+		hdate_sun_table[day_of_year - 1][1] * ((1 << 16) / HDATE_SUN_TABLE_EQTIME_ONE);
+	
+	return;
+}
+
+/**
+ @brief fixed point solar hour angle of an altitude, in Q16 minutes
+
+ @param sun date and place part (see hdate_get_sun_fixed)
+ @param deg thousandths of degrees of sun's altitude (0 -  Zenith .. 90000 - Horizon)
+ @return the hour angle, 0 if the sun never gets to the altitude and
+  12 hours if it never goes down to it
+*/
+static int
+hdate_get_sun_fixed_hour_angle (hdate_sun_fixed const *sun, int deg)
+{
+	/* cos ha = (cos deg - sin lat sin decl) / (cos lat cos decl) */
+	int num = hdate_fixed_cos (hdate_fixed_angle (deg)) - sun->sin_latitude_decl;
+	int cos_ha;
+	
+	if (num >= sun->cos_latitude_decl)
+		cos_ha = HDATE_FIXED_ONE;
+	else if (num <= -sun->cos_latitude_decl)
+		cos_ha = -HDATE_FIXED_ONE;
+	else
+		/* num * 2^30 / cos_latitude_decl by the reciprocal, no division */
+		cos_ha = (int) ((long long) num * sun->recip >> (32 - sun->recip_shift));
+	
+	return (int) (hdate_fixed_acos (cos_ha) * HDATE_FIXED_MINUTES_PER_RADIAN >> 29);
+}
+
+/**
+ @brief fixed point utc sun times of several altitudes
+
+ @param sun date and place part (see hdate_get_sun_fixed)
+ @param deg thousandths of degrees of sun's altitude of each time (0 -  Zenith .. 90000 - Horizon)
+ @param rise_set HDATE_SUN_RISE or HDATE_SUN_SET for each time
+ @param count number of times
+ @param times return the utc time of each altitude in minutes
+*/
+static void
+hdate_get_sun_fixed_times (hdate_sun_fixed const *sun, int const deg[], int const rise_set[], int count, int times[])
+{
+	int ha = 0; /* solar hour angle in Q16 minutes */
+	int i;
+	
+	for (i = 0; i < count; i++)
+	{
+		/* rise and set of the same altitude share the hour angle */
+		if (i == 0 || deg[i] != deg[i - 1])
+			ha = hdate_get_sun_fixed_hour_angle (sun, deg[i]);
+		
+		/* division truncates toward zero, as the casts of the double path */
+		times[i] = ((rise_set[i] == HDATE_SUN_SET) ? sun->noon + ha : sun->noon - ha) / (1 << 16);
+	}
+	
+	return;
+}
+
+/**
+ @brief utc sun times of several altitudes at a gregorian date, in fixed point
+
+ Like hdate_get_utc_sun_times, without floating point math. If the sun
+ never gets to an altitude, its sunrise and sunset are the sun noon; if
+ it never goes down to it, they are 12 hours before and after the noon.
+
+ @param day this day of month
+ @param month this month
+ @param year this year
+ @param latitude latitude to use in calculations, in thousandths of a degree
+ @param longitude longitude to use in calculations, in thousandths of a degree
+ @param deg thousandths of degrees of sun's altitude of each time (0 -  Zenith .. 90000 - Horizon)
+ @param rise_set HDATE_SUN_RISE or HDATE_SUN_SET for each time
+ @param count number of times
+ @param times return the utc time of each altitude in minutes
+*/
+void
+hdate_get_utc_sun_times_fixed (int day, int month, int year, int latitude, int longitude,
+	int const deg[], int const rise_set[], int count, int times[])
+{
+	hdate_sun_fixed sun;
+	
+	hdate_get_sun_fixed (day, month, year, latitude, longitude, &sun);
+	hdate_get_sun_fixed_times (&sun, deg, rise_set, count, times);
+	
+	return;
+}
+
+/**
+ @brief utc sun times for altitude at a gregorian date, in fixed point
+
+ @see hdate_get_utc_sun_times_fixed
+
+ @param day this day of month
+ @param month this month
+ @param year this year
+ @param latitude latitude to use in calculations, in thousandths of a degree
+ @param longitude longitude to use in calculations, in thousandths of a degree
+ @param deg thousandths of degrees of sun's altitude (0 -  Zenith .. 90000 - Horizon)
+ @param sunrise return the utc sunrise in minutes
+ @param sunset return the utc sunset in minutes
+*/
+void
+hdate_get_utc_sun_time_fixed (int day, int month, int year, int latitude, int longitude, int deg, int *sunrise, int *sunset)
+{
+	int const degs[2] = {deg, deg};
+	static const int rise_set[2] = {HDATE_SUN_RISE, HDATE_SUN_SET};
+	int times[2];
+	
+	hdate_get_utc_sun_times_fixed (day, month, year, latitude, longitude, degs, rise_set, 2, times);
+	*sunrise = times[0];
+	*sunset = times[1];
+	
+	return;
+}
+
+/* Precise sun times: the solar coordinates of Meeus (Astronomical
+   Algorithms, chapters 25 and 28) computed at the time of the event,
+   iterating from the sun noon, for schedules computed in batch. */
+#define HDATE_SUN_PRECISE_ITERATIONS 8
+
+/**
+ @brief degrees reduced to one turn, in radians
+*/
+static double
+hdate_sun_radians (double deg)
+{
+	deg -= 360.0 * (double) (long) (deg / 360.0);
+	if (deg < 0.0)
+		deg += 360.0;
+	
+	return M_PI * deg / 180.0;
+}
+
+/**
+ @brief square root, my_sqrt refined by Newton steps
+*/
+static double
+hdate_sun_sqrt (double x)
+{
+	double root;
+	
+	if (x <= 0.0)
+		return 0.0;
+	
+	root = my_sqrt (x);
+	root = 0.5 * (root + x / root);
+	root = 0.5 * (root + x / root);
+	
+	return root;
+}
+
+/**
+ @brief arc cosine, my_acos refined by Newton steps
+*/
+static double
+hdate_sun_acos (double x)
+{
+	double a = my_acos (x);
+	double sin_a = my_sin (a);
+	
+	/* cos a - x = 0, unless a is too near 0 or pi */
+	if (sin_a > 1e-3)
+	{
+		a += (my_cos (a) - x) / sin_a;
+		a += (my_cos (a) - x) / my_sin (a);
+	}
+	
+	return a;
+}
+
+/**
+ @brief apparent sun declination and equation of time at a julian date
+
+ @param jd julian date (julian day number at noon utc)
+ @param sin_decl return the sine of the declination
+ @param cos_decl return the cosine of the declination
+ @param eqtime return the difference between sun noon and clock noon in minutes
+*/
+static void
+hdate_get_sun_position_precise (double jd, double *sin_decl, double *cos_decl, double *eqtime)
+{
+	double t; /* julian centuries from J2000.0 */
+	double l0; /* geometric mean longitude of the sun */
+	double m; /* mean anomaly of the sun */
+	double e; /* eccentricity of earth orbit */
+	double c; /* equation of center in degrees */
+	double omega; /* longitude of the ascending node of the moon */
+	double lambda; /* apparent longitude of the sun */
+	double epsilon; /* obliquity of the ecliptic */
+	double y;
+	
+	t = (jd - 2451545.0) / 36525.0;
+	l0 = hdate_sun_radians (280.46646 + t * (36000.76983 + t * 0.0003032));
+	m = hdate_sun_radians (357.52911 + t * (35999.05029 - t * 0.0001537));
+	e = 0.016708634 - t * (0.000042037 + t * 0.0000001267);
+	omega = hdate_sun_radians (125.04 - 1934.136 * t);
+	
+	c = (1.914602 - t * (0.004817 + t * 0.000014)) * my_sin (m)
+		+ (0.019993 - t * 0.000101) * my_sin (2.0 * m)
+		+ 0.000289 * my_sin (3.0 * m);
+	lambda = l0 + M_PI * (c - 0.00569 - 0.00478 * my_sin (omega)) / 180.0;
+	
+	epsilon = 23.0 + (26.0 + (21.448 - t * (46.815 + t * (0.00059 - t * 0.001813))) / 60.0) / 60.0;
+	epsilon = M_PI * (epsilon + 0.00256 * my_cos (omega)) / 180.0;
+	
+	*sin_decl = my_sin (epsilon) * my_sin (lambda);
+	*cos_decl = hdate_sun_sqrt (1.0 - *sin_decl * *sin_decl);
+	
+	/* equation of time in radians, we use minutes */
+	y = my_tan (epsilon / 2.0);
+	y *= y;
+	*eqtime = 720.0 / M_PI * (y * my_sin (2.0 * l0) - 2.0 * e * my_sin (m)
+		+ 4.0 * e * y * my_sin (m) * my_cos (2.0 * l0)
+		- 0.5 * y * y * my_sin (4.0 * l0) - 1.25 * e * e * my_sin (2.0 * m));
+	
+	return;
+}
+
+/**
+ @brief utc sun times of several altitudes, HDATE_SUN_ACCURACY_PRECISE
+
+ The altitudes are those of Meeus: the 90.833 of sunrise and sunset is
+ the atmospheric refraction at the horizon (34') and the sun radius (16').
+
+ @see hdate_get_utc_sun_times_acc
+*/
+static void
+hdate_get_utc_sun_times_precise (int day, int month, int year, double latitude, double longitude,
+	double const deg[], int const rise_set[], int count, int times[])
+{
+	double jd; /* julian date of 00:00 utc */
+	double sin_latitude, cos_latitude;
+	double sin_decl, cos_decl, eqtime;
+	double cos_ha, ha;
+	double time, previous; /* utc minutes of the event */
+	int i, iteration;
+	
+	jd = hdate_gdate_to_jd (day, month, year) - 0.5;
+	
+	latitude = M_PI * latitude / 180.0;
+	sin_latitude = my_sin (latitude);
+	cos_latitude = my_cos (latitude);
+	
+	for (i = 0; i < count; i++)
+	{
+		/* the sun at the noon, then at the event time found */
+		time = 720.0 - 4.0 * longitude;
+		for (iteration = 0; iteration < HDATE_SUN_PRECISE_ITERATIONS; iteration++)
+		{
+			hdate_get_sun_position_precise (jd + time / 1440.0, &sin_decl, &cos_decl, &eqtime);
+			
+			/* the sun never gets to the altitude, or never goes down to it */
+			cos_ha = (my_cos (M_PI * deg[i] / 180.0) - sin_latitude * sin_decl) / (cos_latitude * cos_decl);
+			if (cos_ha > 1.0)
+				cos_ha = 1.0;
+			if (cos_ha < -1.0)
+				cos_ha = -1.0;
+			ha = 720.0 * hdate_sun_acos (cos_ha) / M_PI;
+			
+			previous = time;
+			time = 720.0 - 4.0 * longitude - eqtime + ((rise_set[i] == HDATE_SUN_SET) ? ha : -ha);
+			if (time - previous < 0.01 && previous - time < 0.01)
+				break;
+		}
+		
+		/* rounded to the nearest minute */
+		times[i] = (time < 0.0) ? -(int) (0.5 - time) : (int) (time + 0.5);
+	}
+	
+	return;
+}
+
+/**
+ @brief thousandths of a degree, rounded
+*/
+static int
+hdate_sun_mdeg (double deg)
+{
+	return (int) ((deg < 0.0) ? deg * 1000.0 - 0.5 : deg * 1000.0 + 0.5);
+}
+
+/* Altitudes of the fixed point tier converted at a time */
+#define HDATE_SUN_FIXED_CHUNK 8
+
+/**
+ @brief utc sun times of several altitudes, HDATE_SUN_ACCURACY_FIXED
+
+ The degrees are converted to thousandths (floating point math) before
+ the fixed point engine runs; callers that have thousandths already
+ should call hdate_get_utc_sun_times_fixed.
+
+ @see hdate_get_utc_sun_times_acc
+*/
+static void
+hdate_get_utc_sun_times_fixed_tier (int day, int month, int year, double latitude, double longitude,
+	double const deg[], int const rise_set[], int count, int times[])
+{
+	hdate_sun_fixed sun;
+	int mdeg[HDATE_SUN_FIXED_CHUNK];
+	int first, size, i;
+	
+	hdate_get_sun_fixed (day, month, year, hdate_sun_mdeg (latitude), hdate_sun_mdeg (longitude), &sun);
+	
+	for (first = 0; first < count; first += size)
+	{
+		size = (count - first < HDATE_SUN_FIXED_CHUNK) ? count - first : HDATE_SUN_FIXED_CHUNK;
+		for (i = 0; i < size; i++)
+			mdeg[i] = hdate_sun_mdeg (deg[first + i]);
+		
+		hdate_get_sun_fixed_times (&sun, mdeg, rise_set + first, size, times + first);
+	}
+	
+	return;
+}
+
+/**
+ @brief utc sun times of several altitudes at a gregorian date, at an accuracy
+
+ Like hdate_get_utc_sun_times, at the accuracy given rather than the
+ one of the build (HDATE_SUN_ACCURACY). The tiers differ where the sun
+ never gets to an altitude, or never goes down to it: the standard one
+ returns negative values, the fixed and precise ones the sun noon, or
+ 12 hours before and after it.
+
+ @param day this day of month
+ @param month this month
+ @param year this year
+ @param latitude latitude to use in calculations
+ @param longitude longitude to use in calculations
+ @param deg degrees of sun's altitude of each time (0 -  Zenith .. 90 - Horizon)
+ @param rise_set HDATE_SUN_RISE or HDATE_SUN_SET for each time
+ @param count number of times
+ @param times return the utc time of each altitude in minutes
+ @param accuracy HDATE_SUN_ACCURACY_FIXED, HDATE_SUN_ACCURACY_STANDARD or
+  HDATE_SUN_ACCURACY_PRECISE
+*/
+void
+hdate_get_utc_sun_times_acc (int day, int month, int year, double latitude, double longitude,
+	double const deg[], int const rise_set[], int count, int times[], int accuracy)
+{
+	hdate_sun_ephemeris eph;
+	
+	switch (accuracy)
+	{
+	case HDATE_SUN_ACCURACY_FIXED:
+		hdate_get_utc_sun_times_fixed_tier (day, month, year, latitude, longitude, deg, rise_set, count, times);
+		break;
+	case HDATE_SUN_ACCURACY_PRECISE:
+		hdate_get_utc_sun_times_precise (day, month, year, latitude, longitude, deg, rise_set, count, times);
+		break;
+	default:
+		hdate_get_sun_ephemeris (day, month, year, &eph);
+		hdate_get_utc_sun_times_eph (&eph, latitude, longitude, deg, rise_set, count, times);
+		break;
+	}
+	
+	return;
+}
+
+/**
+ @brief utc sun times of several altitudes at a gregorian date
+
+ Like hdate_get_utc_sun_time_deg for each altitude, computing the sun
+ ephemeris of the date once. Altitudes wanted for both sunrise and
+ sunset should be given next to each other, to share the computation.
+
+ @param day this day of month
+ @param month this month
+ @param year this year
+ @param latitude latitude to use in calculations
+ @param longitude longitude to use in calculations
+ @param deg degrees of sun's altitude of each time (0 -  Zenith .. 90 - Horizon)
+ @param rise_set HDATE_SUN_RISE or HDATE_SUN_SET for each time
+ @param count number of times
+ @param times return the utc time of each altitude in minutes
+*/
+void
+hdate_get_utc_sun_times (int day, int month, int year, double latitude, double longitude,
+	double const deg[], int const rise_set[], int count, int times[])
+{
+	hdate_get_utc_sun_times_acc (day, month, year, latitude, longitude, deg, rise_set, count, times,
+		HDATE_SUN_ACCURACY);
+	
+	return;
+}
+
+/**
+ @brief utc sun times for altitude at a gregorian date
+
+ Returns the sunset and sunrise times in minutes from 00:00 (utc time)
+ if sun altitude in sunrise is deg degries.
+ This function only works for altitudes sun realy is.
+ If the sun never get to this altitude, the returned sunset and sunrise values 
+ will be negative. This can happen in low altitude when latitude is 
+ nearing the pols in winter times, the sun never goes very high in 
+ the sky there.
+ The accuracy of the times is the one of the build (HDATE_SUN_ACCURACY).
+
+ @param day this day of month
+ @param month this month
+ @param year this year
+ @param longitude longitude to use in calculations
+ @param latitude latitude to use in calculations
+ @param deg degrees of sun's altitude (0 -  Zenith .. 90 - Horizon)
+ @param sunrise return the utc sunrise in minutes
+ @param sunset return the utc sunset in minutes
+*/
+void
+hdate_get_utc_sun_time_deg (int day, int month, int year, double latitude, double longitude, double deg, int *sunrise, int *sunset)
+{
+	double const degs[2] = {deg, deg};
+	static const int rise_set[2] = {HDATE_SUN_RISE, HDATE_SUN_SET};
+	int times[2];
+	
+	hdate_get_utc_sun_times (day, month, year, latitude, longitude, degs, rise_set, 2, times);
+	*sunrise = times[0];
+	*sunset = times[1];
 	
 	return;
 }
@@ -174,20 +870,24 @@ hdate_get_utc_sun_time_full (int day, int month, int year, double latitude, doub
 	int *sun_hour, int *first_light, int *talit, int *sunrise,
 	int *midday, int *sunset, int *first_stars, int *three_stars)
 {
-	int place_holder;
+	/* sunrise, sunset, alut ha-shachar, talit, tzeit hacochavim, shlosha cochavim */
+	static const double deg[6] = {90.833, 90.833, 106.01, 101.0, 96.0, 98.5};
+	static const int rise_set[6] = {HDATE_SUN_RISE, HDATE_SUN_SET,
+		HDATE_SUN_RISE, HDATE_SUN_RISE, HDATE_SUN_SET, HDATE_SUN_SET};
+	int times[6];
 	
-	/* sunset and rise time */
-	hdate_get_utc_sun_time_deg (day, month, year, latitude, longitude, 90.833, sunrise, sunset);
+	hdate_get_utc_sun_times (day, month, year, latitude, longitude, deg, rise_set, 6, times);
+	
+	*sunrise = times[0];
+	*sunset = times[1];
+	*first_light = times[2];
+	*talit = times[3];
+	*first_stars = times[4];
+	*three_stars = times[5];
 	
 	/* shaa zmanit by gara, 1/12 of light time */
 	*sun_hour = (*sunset - *sunrise) / 12;
 	*midday = (*sunset + *sunrise) / 2;
 	
-	/* get times of the different sun angles */
-	hdate_get_utc_sun_time_deg (day, month, year, latitude, longitude, 106.01, first_light, &place_holder);
-	hdate_get_utc_sun_time_deg (day, month, year, latitude, longitude, 101.0, talit, &place_holder);
-	hdate_get_utc_sun_time_deg (day, month, year, latitude, longitude, 96.0, &place_holder, first_stars);
-	hdate_get_utc_sun_time_deg (day, month, year, latitude, longitude, 98.5, &place_holder, three_stars);
-	
 	return;
 }
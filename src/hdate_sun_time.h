@@ -9,6 +9,201 @@
 #ifndef TBK_Jewish_Clock_hdate_sun_time_h
 #define TBK_Jewish_Clock_hdate_sun_time_h
 
+/** @def HDATE_SUN_RISE
+ @brief for hdate_get_utc_sun_times: the time the sun goes up through the altitude
+ */
+#define HDATE_SUN_RISE 0
+
+/** @def HDATE_SUN_SET
+ @brief for hdate_get_utc_sun_times: the time the sun goes down through the altitude
+ */
+#define HDATE_SUN_SET 1
+
+/** @def HDATE_SUN_ACCURACY_FIXED
+ @brief for hdate_get_utc_sun_times_acc: the fixed point engine of
+  hdate_get_utc_sun_times_fixed, about as accurate as the standard tier;
+  the degrees are still converted with floating point math. Where the
+  sun never gets to an altitude, or never goes down to it, the times are
+  the sun noon, or 12 hours before and after it.
+ */
+#define HDATE_SUN_ACCURACY_FIXED 0
+
+/** @def HDATE_SUN_ACCURACY_STANDARD
+ @brief for hdate_get_utc_sun_times_acc: the low accuracy NOAA equations at the date,
+  times truncated to the minute. Where the sun never gets to an altitude
+  the times are negative, as documented for hdate_get_utc_sun_time_deg.
+ */
+#define HDATE_SUN_ACCURACY_STANDARD 1
+
+/** @def HDATE_SUN_ACCURACY_PRECISE
+ @brief for hdate_get_utc_sun_times_acc: the Meeus solar coordinates iterated at the
+  time of the event, times rounded to the minute. Unlike the standard tier,
+  where the sun never gets to an altitude, or never goes down to it, the
+  hour angle is clamped and the times are the sun noon, or 12 hours
+  before and after it.
+ */
+#define HDATE_SUN_ACCURACY_PRECISE 2
+
+/** @def HDATE_SUN_ACCURACY
+ @brief the accuracy of hdate_get_utc_sun_times and the functions using it,
+  may be set at build time
+ */
+#ifndef HDATE_SUN_ACCURACY
+#define HDATE_SUN_ACCURACY HDATE_SUN_ACCURACY_STANDARD
+#endif
+
+/** @struct hdate_sun_ephemeris
+ @brief Date dependent part of the sun times, see hdate_get_sun_ephemeris
+ */
+typedef struct
+{
+	/** Difference between sun noon and clock noon in minutes. */
+	double eqtime;
+	/** Sun declination in radians. */
+	double decl;
+	/** Sine of the declination. */
+	double sin_decl;
+	/** Cosine of the declination. */
+	double cos_decl;
+} hdate_sun_ephemeris;
+
+/**
+ @brief sun ephemeris of a gregorian date
+ 
+ Computes the date dependent part of the sun times once, so the times of
+ several sun altitudes (see hdate_get_utc_sun_time_eph) can share it.
+ 
+ @parm day this day of month
+ @parm month this month
+ @parm year this year
+ @parm eph return the sun ephemeris of this date
+ */
+void
+hdate_get_sun_ephemeris (int day, int month, int year, hdate_sun_ephemeris *eph);
+
+/**
+ @brief utc sun times for altitude, from the sun ephemeris of the date
+ 
+ @parm eph sun ephemeris of the date (see hdate_get_sun_ephemeris)
+ @parm latitude latitude to use in calculations
+ @parm longitude longitude to use in calculations
+ @parm deg degrees of sun's altitude (0 -  Zenith .. 90 - Horizon)
+ @parm sunrise return the utc sunrise in minutes
+ @parm sunset return the utc sunset in minutes
+ */
+void
+hdate_get_utc_sun_time_eph (hdate_sun_ephemeris const *eph, double latitude, double longitude, double deg, int *sunrise, int *sunset);
+
+/**
+ @brief utc sun times of several altitudes, from the sun ephemeris of the date
+ 
+ @parm eph sun ephemeris of the date (see hdate_get_sun_ephemeris)
+ @parm latitude latitude to use in calculations
+ @parm longitude longitude to use in calculations
+ @parm deg degrees of sun's altitude of each time (0 -  Zenith .. 90 - Horizon)
+ @parm rise_set HDATE_SUN_RISE or HDATE_SUN_SET for each time
+ @parm count number of times
+ @parm times return the utc time of each altitude in minutes
+ */
+void
+hdate_get_utc_sun_times_eph (hdate_sun_ephemeris const *eph, double latitude, double longitude,
+                             double const deg[], int const rise_set[], int count, int times[]);
+
+/**
+ @brief utc sun times of several altitudes at a gregorian date
+ 
+ Like hdate_get_utc_sun_time_deg for each altitude, computing the sun
+ ephemeris of the date once. Altitudes wanted for both sunrise and
+ sunset should be given next to each other, to share the computation.
+ 
+ @parm day this day of month
+ @parm month this month
+ @parm year this year
+ @parm latitude latitude to use in calculations
+ @parm longitude longitude to use in calculations
+ @parm deg degrees of sun's altitude of each time (0 -  Zenith .. 90 - Horizon)
+ @parm rise_set HDATE_SUN_RISE or HDATE_SUN_SET for each time
+ @parm count number of times
+ @parm times return the utc time of each altitude in minutes
+ */
+void
+hdate_get_utc_sun_times (int day, int month, int year, double latitude, double longitude,
+                         double const deg[], int const rise_set[], int count, int times[]);
+
+/**
+ @brief utc sun times of several altitudes at a gregorian date, at an accuracy
+ 
+ Like hdate_get_utc_sun_times, at the accuracy given rather than the
+ one of the build (HDATE_SUN_ACCURACY). The tiers differ where the sun
+ never gets to an altitude (see HDATE_SUN_ACCURACY_STANDARD).
+ 
+ @parm day this day of month
+ @parm month this month
+ @parm year this year
+ @parm latitude latitude to use in calculations
+ @parm longitude longitude to use in calculations
+ @parm deg degrees of sun's altitude of each time (0 -  Zenith .. 90 - Horizon)
+ @parm rise_set HDATE_SUN_RISE or HDATE_SUN_SET for each time
+ @parm count number of times
+ @parm times return the utc time of each altitude in minutes
+ @parm accuracy HDATE_SUN_ACCURACY_FIXED, HDATE_SUN_ACCURACY_STANDARD or
+  HDATE_SUN_ACCURACY_PRECISE
+ */
+void
+hdate_get_utc_sun_times_acc (int day, int month, int year, double latitude, double longitude,
+                             double const deg[], int const rise_set[], int count, int times[], int accuracy);
+
+/**
+ @brief utc sun times for altitude at a gregorian date
+ 
+ @parm day this day of month
+ @parm month this month
+ @parm year this year
+ @parm longitude longitude to use in calculations
+ @parm latitude latitude to use in calculations
+ @parm deg degrees of sun's altitude (0 -  Zenith .. 90 - Horizon)
+ @parm sunrise return the utc sunrise in minutes
+ @parm sunset return the utc sunset in minutes
+ */
+void
+hdate_get_utc_sun_time_deg (int day, int month, int year, double latitude, double longitude, double deg, int *sunrise, int *sunset);
+
+/**
+ @brief utc sun times of several altitudes at a gregorian date, in fixed point
+ 
+ Like hdate_get_utc_sun_times, without floating point math. If the sun
+ never gets to an altitude, its sunrise and sunset are the sun noon; if
+ it never goes down to it, they are 12 hours before and after the noon.
+ 
+ @parm day this day of month
+ @parm month this month
+ @parm year this year
+ @parm latitude latitude to use in calculations, in thousandths of a degree
+ @parm longitude longitude to use in calculations, in thousandths of a degree
+ @parm deg thousandths of degrees of sun's altitude of each time (0 -  Zenith .. 90000 - Horizon)
+ @parm rise_set HDATE_SUN_RISE or HDATE_SUN_SET for each time
+ @parm count number of times
+ @parm times return the utc time of each altitude in minutes
+ */
+void
+hdate_get_utc_sun_times_fixed (int day, int month, int year, int latitude, int longitude,
+                               int const deg[], int const rise_set[], int count, int times[]);
+
+/**
+ @brief utc sun times for altitude at a gregorian date, in fixed point
+ 
+ @parm day this day of month
+ @parm month this month
+ @parm year this year
+ @parm latitude latitude to use in calculations, in thousandths of a degree
+ @parm longitude longitude to use in calculations, in thousandths of a degree
+ @parm deg thousandths of degrees of sun's altitude (0 -  Zenith .. 90000 - Horizon)
+ @parm sunrise return the utc sunrise in minutes
+ @parm sunset return the utc sunset in minutes
+ */
+void
+hdate_get_utc_sun_time_fixed (int day, int month, int year, int latitude, int longitude, int deg, int *sunrise, int *sunset);
+
 /**
  @brief utc sunrise/set time for a gregorian date
  
@@ -23,19 +23,135 @@
 
 #include "hebrewdate.h"
 
+#ifndef HDATE_NO_NEW_YEAR_TABLE
+#include "hdate_new_year_table.h"
+
+/* Length of year by year type 1..14 */
+static const short year_type_sizes[14] =
+	{353, 353, 354, 354, 355, 355, 355, 383, 383, 383, 384, 385, 385, 385};
+#endif
+
 #define HOUR 1080
 #define DAY  (24*HOUR)
 #define WEEK (7*DAY)
 #define M(h,p) ((h)*HOUR+p)
 #define MONTH (DAY+M(12,793))	/* Tikun for regular month */
 
-// Hebrew month names in english
-char *hebrewMonthNames[14] = {
+/* HDATE_EXTENDED_RANGE keeps the molad in 64 bits and rounds divisions
+   toward minus infinity, so years far before 3744 and far after 8000
+   come out right. The default build keeps the 32 bits arithmetic. */
+#ifdef HDATE_EXTENDED_RANGE
+typedef long long parts_t;
+#define DIV(a,b) (((a) >= 0) ? DIVISION ((a) / (b)) : DIVISION (((a) - (b) + 1) / (b)))
+#define MOD(a,b) ((a) - (b) * DIV (a, b))
+#else
+typedef int parts_t;
+#define DIV(a,b) DIVISION ((a) / (b))
+#define MOD(a,b) DIVISION ((a) % (b))
+#endif
+
+/* HDATE_COUNT_DIVISIONS counts the integer divisions of the molad
+   arithmetic in hdate_divisions, for tools/bench_jd_tishrey1.c */
+#ifdef HDATE_COUNT_DIVISIONS
+long hdate_divisions;
+#define DIVISION(q) (hdate_divisions++, (q))
+#else
+#define DIVISION(q) (q)
+#endif
+
+/* The gregorian conversions use the Euclidean affine functions of
+   Neri and Schneider (2022): a couple of multiplications and shifts in
+   place of the divisions of the Fliegel and Van Flandern formulas.
+   Days are counted in a computational calendar starting 1 March, moved
+   forward by EAF_CYCLES 400 years cycles to keep everything unsigned;
+   dates between -360000 and 374000 are exact. HDATE_NO_EAF_GREGORIAN
+   builds the 1968 formulas instead. */
+#ifndef HDATE_NO_EAF_GREGORIAN
+#define EAF_CYCLES 900
+#define EAF_JD_MARCH_0 1721120	/* julian day of 1 March, year 0 */
+#endif
+
+/* The bulk gregorian conversions run GDATE_LANES dates at a time with
+   GCC vector extensions where the target has SIMD registers, and fall
+   back to the scalar functions elsewhere (e.g. on the watch). */
+#if (defined (__clang__) || (defined (__GNUC__) && __GNUC__ >= 9)) \
+    && (defined (__SSE2__) || defined (__ARM_NEON))
+#define GDATE_VECTOR
+#ifdef __AVX2__
+#define GDATE_LANES 8
+#else
+#define GDATE_LANES 4
+#endif
+/* Plain SSE2 has no 32x32->64 bits lane multiply to build DIV_MS_WIDE
+   on, the scalar hdate_jd_to_gdate is faster there */
+#if defined (__AVX2__) || defined (__ARM_NEON)
+#define GDATE_VECTOR_WIDE
+#endif
+typedef int gdate_vint __attribute__ ((vector_size (4 * GDATE_LANES)));
+typedef long long gdate_vlong __attribute__ ((vector_size (8 * GDATE_LANES)));
+
+/* x / d for 0 <= x < 2^n as (x * mul) >> shift, with mul = ceil (2^shift / d)
+   and mul * d - 2^shift < 2^(shift - n). DIV_MS keeps the product in 32 bits,
+   DIV_MS_WIDE widens to 64 bits for the large divisors. */
+#define DIV_MS(x, mul, shift) (((x) * (mul)) >> (shift))
+#define DIV_MS_WIDE(x, mul, shift) \
+	__builtin_convertvector ((__builtin_convertvector ((x), gdate_vlong) * (mul)) >> (shift), gdate_vint)
+#endif
+
+/* Number of cached year descriptors, must be a power of 2 */
+#define YEAR_CACHE_SIZE 4
+
+/* HDATE_THREAD_LOCAL keeps the year cache per thread, so the host batch
+   conversions can run from many threads at once. The watch (bare metal
+   arm, no thread storage) and HDATE_NO_THREAD_LOCAL builds share it. */
+#if defined (HDATE_NO_THREAD_LOCAL) || \
+	(defined (__arm__) && !defined (__linux__) && !defined (__APPLE__))
+#define HDATE_THREAD_LOCAL
+#elif defined (__GNUC__)
+#define HDATE_THREAD_LOCAL __thread
+#elif defined (__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+#define HDATE_THREAD_LOCAL _Thread_local
+#else
+#define HDATE_THREAD_LOCAL
+#endif
+
+/* Year descriptors cache, an empty slot has size_of_year 0 */
+static HDATE_THREAD_LOCAL hdate_year_info year_cache[YEAR_CACHE_SIZE];
+
+// Hebrew month names in english, kept in place rather than by pointers,
+// so the table has no relocations
+static const char hebrewMonthNames[14][9] = {
   "Tishrei", "Cheshvan", "Kislev", "Tevet",
   "Sh'vat", "Adar", "Nisan", "Iyyar",
   "Sivan", "Tammuz", "Av", "Elul", "Adar I",
   "Adar II"};
 
+/* Hebrew numerals of the days of the month 1..30, long form with
+   geresh and gershayim, short form without; kept in place rather than
+   by pointers, so the table has no relocations */
+static const char hebrewDayNumbers[2][30][6] = {
+	{
+		"א'", "ב'", "ג'", "ד'", "ה'", "ו'", "ז'", "ח'", "ט'", "י'",
+		"י\"א", "י\"ב", "י\"ג", "י\"ד", "ט\"ו", "ט\"ז", "י\"ז", "י\"ח", "י\"ט", "כ'",
+		"כ\"א", "כ\"ב", "כ\"ג", "כ\"ד", "כ\"ה", "כ\"ו", "כ\"ז", "כ\"ח", "כ\"ט", "ל'",
+	},
+	{
+		"א", "ב", "ג", "ד", "ה", "ו", "ז", "ח", "ט", "י",
+		"יא", "יב", "יג", "יד", "טו", "טז", "יז", "יח", "יט", "כ",
+		"כא", "כב", "כג", "כד", "כה", "כו", "כז", "כח", "כט", "ל",
+	}
+};
+
+/* Hebrew letters are 0xd7 followed by one of these bytes in utf-8;
+   units 1..9, tens 10..90 and hundreds 100..400, 0 for none */
+#define HEBREW_LETTER_LEAD 0xd7
+static const unsigned char hebrewUnits[10] =
+	{0, 0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98};
+static const unsigned char hebrewTens[10] =
+	{0, 0x99, 0x9b, 0x9c, 0x9e, 0xa0, 0xa1, 0xa2, 0xa4, 0xa6};
+static const unsigned char hebrewHundreds[5] =
+	{0, 0xa7, 0xa8, 0xa9, 0xaa};
+
 /**
  @brief Compute Julian day from Gregorian day, month and year
  Algorithm from the wikipedia's julian_day
@@ -50,6 +166,18 @@ char *hebrewMonthNames[14] = {
 int
 hdate_gdate_to_jd (int day, int month, int year)
 {
+#ifndef HDATE_NO_EAF_GREGORIAN
+	unsigned int j, y, m, c;
+	
+	/* Years start on 1 March, january and february are months 13, 14 */
+	j = (month <= 2);
+	y = (unsigned int) year + 400 * EAF_CYCLES - j;
+	m = (unsigned int) month + 12 * j;
+	c = ((unsigned long long) y * 2684355) >> 28;	/* y / 100 */
+	
+	return (int) ((1461 * y) / 4 - c + c / 4 + (979 * m - 2919) / 32 - 146097 * EAF_CYCLES)
+		+ day - 1 + EAF_JD_MARCH_0;
+#else
 	int a;
 	int y;
 	int m;
@@ -62,6 +190,97 @@ hdate_gdate_to_jd (int day, int month, int year)
 	jdn = day + (153 * m + 2) / 5 + 365 * y + y / 4 - y / 100 + y / 400 - 32045;
 	
 	return jdn;
+#endif
+}
+
+/**
+ @brief Days from 1 Tishrey to a Hebrew day and month
+ 
+ @param info The year descriptor
+ @param day Day of month 1..31
+ @param month Month 1..14 (13 - Adar 1, 14 - Adar 2)
+ @return Number of days since 1 Tishrey, 0 for 1 Tishrey
+ */
+static int
+hdate_days_from_tishrey1 (hdate_year_info const *info, int day, int month)
+{
+	/* Adjust for leap year */
+	if (month == 13)
+	{
+		month = 6;
+	}
+	if (month == 14)
+	{
+		month = 6;
+		day += 30;
+	}
+	
+	day = (59 * (month - 1) + 1) / 2 + day - 1;
+	
+	/* Special cases for this year */
+	if (info->size_of_year % 10 > 4 && month > 2)	/* long Heshvan */
+		day++;
+	if (info->size_of_year % 10 < 4 && month > 3)	/* short Kislev */
+		day--;
+	if (info->leap && month > 6)	/* leap year */
+		day += 30;
+	
+	return day;
+}
+
+/**
+ @brief Compute Julian day from Hebrew day, month and year
+ 
+ @author Amos Shapir 1984 (rev. 1985, 1992) Yaacov Zamir 2003-2005
+ 
+ @param day Day of month 1..31
+ @param month Month 1..14 (13 - Adar 1, 14 - Adar 2)
+ @param year Hebrew year in 4 digits e.g. 5753
+ @param jd_tishrey1 return the julian number of 1 Tishrey this year
+ @param jd_tishrey1_next_year return the julian number of 1 Tishrey next year
+ @return The julian day number
+ */
+int
+hdate_hdate_to_jd (int day, int month, int year, int *jd_tishrey1, int *jd_tishrey1_next_year)
+{
+	hdate_year_info info;
+	
+	hdate_get_year_info (year, &info);
+	
+	/* return the 1 of tishrey julians */
+	if (jd_tishrey1 && jd_tishrey1_next_year)
+	{
+		*jd_tishrey1 = info.jd_tishrey1;
+		*jd_tishrey1_next_year = info.jd_tishrey1 + info.size_of_year;
+	}
+	
+	return info.jd_tishrey1 + hdate_days_from_tishrey1 (&info, day, month);
+}
+
+/**
+ @brief Compute Julian days from an array of Hebrew dates
+ 
+ The year descriptor is only looked up again when the year changes.
+ 
+ @param dates Hebrew dates to convert
+ @param count Number of dates
+ @param jd return count julian day numbers
+ */
+void
+hdate_hdate_to_jd_bulk (hdate_date const dates[], int count, int jd[])
+{
+	hdate_year_info info;
+	int i;
+	
+	for (i = 0; i < count; i++)
+	{
+		if (i == 0 || dates[i].year != info.year)
+			hdate_get_year_info (dates[i].year, &info);
+		
+		jd[i] = info.jd_tishrey1 + hdate_days_from_tishrey1 (&info, dates[i].day, dates[i].month);
+	}
+	
+	return;
 }
 
 /**
@@ -79,29 +298,32 @@ hdate_jd_to_hdate (int jd, int *day, int *month, int *year, int *jd_tishrey1, in
 {
 	int days;
 	int size_of_year;
-	int internal_jd_tishrey1, internal_jd_tishrey1_next_year;
+	hdate_year_info info;
 	
-	/* calculate Gregorian date */
-	hdate_jd_to_gdate (jd, day, month, year);
-  
-	/* Guess Hebrew year is Gregorian year + 3760 */
-	*year = *year + 3760;
-  
-	internal_jd_tishrey1 = hdate_days_from_3744 (*year) + 1715119;
-	internal_jd_tishrey1_next_year = hdate_days_from_3744 (*year + 1) + 1715119;
+#ifdef HDATE_EXTENDED_RANGE
+	/* Guess Hebrew year from the mean year length, 235 months of
+	   765433 parts in 19 years of 25920 parts days; the offset keeps
+	   the guess from ever being too high */
+	*year = (int) DIV ((long long) (jd - 348168) * (19 * DAY), 235LL * 765433) + 1;
+#else
+	/* Guess Hebrew year from the mean year length, 19 years are about
+	   6940 days; the offset keeps the guess from ever being too high */
+	*year = (19 * (jd + 17452)) / 6940 - 1000;
+#endif
+	
+	hdate_get_year_info (*year, &info);
 	
 	/* Check if computed year was underestimated */
-	if (internal_jd_tishrey1_next_year <= jd)
+	if (info.jd_tishrey1 + info.size_of_year <= jd)
 	{
 		*year = *year + 1;
-		internal_jd_tishrey1 = internal_jd_tishrey1_next_year;
-		internal_jd_tishrey1_next_year = hdate_days_from_3744 (*year + 1) + 1715119;
+		hdate_get_year_info (*year, &info);
 	}
   
-	size_of_year = internal_jd_tishrey1_next_year - internal_jd_tishrey1;
+	size_of_year = info.size_of_year;
 	
 	/* days into this year, first month 0..29 */
-	days = jd - internal_jd_tishrey1;
+	days = jd - info.jd_tishrey1;
 	
 	/* last 8 months allways have 236 days */
 	if (days >= (size_of_year - 236)) /* in last 8 months */
@@ -146,8 +368,89 @@ hdate_jd_to_hdate (int jd, int *day, int *month, int *year, int *jd_tishrey1, in
 	/* return the 1 of tishrey julians */
 	if (jd_tishrey1 && jd_tishrey1_next_year)
 	{
-		*jd_tishrey1 = internal_jd_tishrey1;
-		*jd_tishrey1_next_year = internal_jd_tishrey1_next_year;
+		*jd_tishrey1 = info.jd_tishrey1;
+		*jd_tishrey1_next_year = info.jd_tishrey1 + info.size_of_year;
+	}
+	
+	return;
+}
+
+/**
+ @brief Length of a Hebrew month in days
+ 
+ @param info The year descriptor
+ @param month Month 1..14 (13 - Adar 1, 14 - Adar 2)
+ @return Number of days in the month
+ */
+static int
+hdate_get_month_length (hdate_year_info const *info, int month)
+{
+	/* Odd months have 30 days, even months 29, Adar I has 30 */
+	if (month == 2 && info->size_of_year % 10 > 4) /* long Heshvan */
+		return 30;
+	if (month == 3 && info->size_of_year % 10 < 4) /* short Kislev */
+		return 29;
+	if (month == 13)
+		return 30;
+	
+	return 30 - ((month + 1) & 1);
+}
+
+/**
+ @brief Converting a span of Julian days to Hebrew dates
+ 
+ The year is resolved once for the first day, then days, months and
+ years are stepped using the month lengths of the year.
+ 
+ @param jd_start Julian day of the first date
+ @param count Number of consecutive days to convert
+ @param out return count Hebrew dates
+ */
+void
+hdate_jd_range_to_hdate (int jd_start, int count, hdate_date out[])
+{
+	int day, month, year;
+	int month_length;
+	int i;
+	hdate_year_info info;
+	
+	if (count <= 0)
+		return;
+	
+	hdate_jd_to_hdate (jd_start, &day, &month, &year, 0, 0);
+	hdate_get_year_info (year, &info);
+	month_length = hdate_get_month_length (&info, month);
+	
+	for (i = 0; i < count; i++)
+	{
+		out[i].day = day;
+		out[i].month = month;
+		out[i].year = year;
+		
+		if (day < month_length)
+		{
+			day++;
+			continue;
+		}
+		
+		/* next month */
+		day = 1;
+		if (month == 12) /* new year */
+		{
+			month = 1;
+			year++;
+			hdate_get_year_info (year, &info);
+		}
+		else if (month == 5 && info.leap)
+			month = 13;
+		else if (month == 13)
+			month = 14;
+		else if (month == 14)
+			month = 7;
+		else
+			month++;
+		
+		month_length = hdate_get_month_length (&info, month);
 	}
 	
 	return;
@@ -167,6 +470,28 @@ hdate_jd_to_hdate (int jd, int *day, int *month, int *year, int *jd_tishrey1, in
 void
 hdate_jd_to_gdate (int jd, int *d, int *m, int *y)
 {
+#ifndef HDATE_NO_EAF_GREGORIAN
+	unsigned int n, c, z, n_y, n_m, j;
+	
+	/* Century and day of century */
+	n = 4 * ((unsigned int) jd - EAF_JD_MARCH_0 + 146097 * EAF_CYCLES) + 3;
+	c = ((unsigned long long) n * 963315389) >> 47;	/* n / 146097 */
+	n = (n - 146097 * c) | 3;
+	
+	/* Year of century and day of year */
+	z = ((unsigned long long) n * 2939745) >> 32;
+	n_y = n / 4 - 365 * z - z / 4;
+	
+	/* Month and day, 3 - March .. 14 - February */
+	n_m = (2141 * n_y + 197913) >> 16;
+	j = (n_y >= 306);
+	
+	*d = n_y - (979 * n_m - 2919) / 32 + 1;
+	*m = n_m - 12 * j;
+	*y = 100 * c + z + j - 400 * EAF_CYCLES;
+	
+	return;
+#else
 	int l, n, i, j;
 	l = jd + 68569;
 	n = (4 * l) / 146097;
@@ -180,6 +505,164 @@ hdate_jd_to_gdate (int jd, int *d, int *m, int *y)
 	*y = 100 * (n - 49) + i + l;	/* that's a lower-case L */
   
 	return;
+#endif
+}
+
+#ifdef GDATE_VECTOR
+/**
+ @brief True if all lanes of a comparison mask are set
+ */
+static int
+gdate_all_lanes (gdate_vint mask)
+{
+	int k;
+	
+	for (k = 0; k < GDATE_LANES; k++)
+		if (!mask[k])
+			return 0;
+	
+	return 1;
+}
+#endif
+
+/**
+ @brief Compute Julian days from arrays of Gregorian dates
+ 
+ Same results as hdate_gdate_to_jd. The divisions are done as multiply
+ and shift, GDATE_LANES dates at a time where SIMD is available.
+ 
+ @param day Days of month 1..31
+ @param month Months 1..12
+ @param year Years in 4 digits e.g. 2001
+ @param count Number of dates
+ @param jd return count julian day numbers
+ */
+void
+hdate_gdate_to_jd_bulk (int const day[], int const month[], int const year[], int count, int jd[])
+{
+	int i = 0;
+	
+#ifdef GDATE_VECTOR
+	gdate_vint d, m, y, a, jdn;
+	int k;
+	
+	for (; i + GDATE_LANES <= count; i += GDATE_LANES)
+	{
+		__builtin_memcpy (&d, day + i, sizeof (d));
+		__builtin_memcpy (&m, month + i, sizeof (m));
+		__builtin_memcpy (&y, year + i, sizeof (y));
+		
+		/* 1 for january and february, comparisons give -1 */
+		a = -(m < 3);
+		y = y + 4800 - a;
+		m = m + 12 * a - 3;
+		
+		/* out of the multiply-shift range, let the scalar code do it */
+		if (!gdate_all_lanes ((m >= 0) & (m < 12) & (y >= 0) & (y < (1 << 17))))
+		{
+			for (k = i; k < i + GDATE_LANES; k++)
+				jd[k] = hdate_gdate_to_jd (day[k], month[k], year[k]);
+			continue;
+		}
+		
+		/* y / 100 is (y / 4) / 25 and y / 400 is (y / 16) / 25 */
+		jdn = d + DIV_MS (153 * m + 2, 3277, 14) + 365 * y + (y >> 2)
+			- DIV_MS (y >> 2, 5243, 17) + DIV_MS (y >> 4, 5243, 17) - 32045;
+		
+		__builtin_memcpy (jd + i, &jdn, sizeof (jdn));
+	}
+#endif
+	
+	for (; i < count; i++)
+		jd[i] = hdate_gdate_to_jd (day[i], month[i], year[i]);
+	
+	return;
+}
+
+/**
+ @brief Converting from arrays of Julian days to Gregorian dates
+ 
+ Same results as hdate_jd_to_gdate. The divisions are done as multiply
+ and shift, GDATE_LANES days at a time where SIMD is available.
+ 
+ @param jd Julian days
+ @param count Number of days
+ @param day return Days of month 1..31
+ @param month return Months 1..12
+ @param year return Years in 4 digits e.g. 2001
+ */
+void
+hdate_jd_to_gdate_bulk (int const jd[], int count, int day[], int month[], int year[])
+{
+	int i = 0;
+	
+#ifdef GDATE_VECTOR_WIDE
+	gdate_vint l, n, c, j, d, m, y;
+	int k;
+	
+	for (; i + GDATE_LANES <= count; i += GDATE_LANES)
+	{
+		__builtin_memcpy (&l, jd + i, sizeof (l));
+		
+		l = l + 68569;
+		
+		/* out of the multiply-shift range, let the scalar code do it */
+		if (!gdate_all_lanes ((l >= 0) & (l < (1 << 24))))
+		{
+			for (k = i; k < i + GDATE_LANES; k++)
+				hdate_jd_to_gdate (jd[k], &day[k], &month[k], &year[k]);
+			continue;
+		}
+		
+		n = DIV_MS_WIDE (4 * l, 15051803LL, 41);	/* / 146097 */
+		l = l - ((146097 * n + 3) >> 2);
+		c = DIV_MS_WIDE (4000 * (l + 1), 1541271919LL, 51);	/* / 1461001 */
+		l = l - ((1461 * c) >> 2) + 31;
+		j = DIV_MS (80 * l, 27425, 26);	/* / 2447 */
+		d = l - DIV_MS (2447 * j, 52429, 22);	/* / 80 */
+		l = DIV_MS (j, 373, 12);	/* / 11 */
+		m = j + 2 - (12 * l);
+		y = 100 * (n - 49) + c + l;
+		
+		__builtin_memcpy (day + i, &d, sizeof (d));
+		__builtin_memcpy (month + i, &m, sizeof (m));
+		__builtin_memcpy (year + i, &y, sizeof (y));
+	}
+#endif
+	
+	for (; i < count; i++)
+		hdate_jd_to_gdate (jd[i], &day[i], &month[i], &year[i]);
+	
+	return;
+}
+
+/**
+ @brief Postpone the new year from the molad day (Molad Zaken and ADU rules)
+ 
+ @param days Days since 3,1,3744 of the molad
+ @param week_day Week day of the molad, 0 - saturday
+ @param parts_left_in_day Parts of the molad into its day
+ @param leap_left Months left of leap cycle
+ @return Number of days since 3,1,3744 of the new year
+ */
+static int
+hdate_postpone_new_year (int days, int week_day, int parts_left_in_day, int leap_left)
+{
+	int postpone;
+	
+	/* Special cases of Molad Zaken; the tests are combined without
+	   branches, scattered years would mispredict them */
+	postpone = ((leap_left < 12) & (week_day == 3)
+	            & (parts_left_in_day >= M (9 + 6, 204))) |
+	           ((leap_left < 7) & (week_day == 2)
+	            & (parts_left_in_day >= M (15 + 6, 589)));
+	days += postpone;
+	week_day += postpone;
+	
+	/* ADU, bits 1, 4 and 6 of 0x52 */
+	days += (0x52 >> week_day) & 1;
+	
+	return days;
 }
 
 /**
@@ -198,7 +681,7 @@ hdate_days_from_3744 (int hebrew_year)
 	int leap_months;
 	int leap_left;
 	int months;
-	int parts;
+	parts_t parts;
 	int days;
 	int parts_left_in_week;
 	int parts_left_in_day;
@@ -209,35 +692,192 @@ hdate_days_from_3744 (int hebrew_year)
 	molad_3744 = M (1 + 6, 779);	/* Molad 3744 + 6 hours in parts */
   
 	/* Time in months */
-	leap_months = (years_from_3744 * 7 + 1) / 19;	/* Number of leap months */
-	leap_left = (years_from_3744 * 7 + 1) % 19;	/* Months left of leap cycle */
+	leap_months = DIV (years_from_3744 * 7 + 1, 19);	/* Number of leap months */
+	leap_left = MOD (years_from_3744 * 7 + 1, 19);	/* Months left of leap cycle */
 	months = years_from_3744 * 12 + leap_months;	/* Total Number of months */
   
 	/* Time in parts and days */
-	parts = months * MONTH + molad_3744;	/* Molad This year + Molad 3744 - corections */
-	days = months * 28 + parts / DAY - 2;	/* 28 days in month + corections */
+	parts = (parts_t) months * MONTH + molad_3744;	/* Molad This year + Molad 3744 - corections */
+	days = months * 28 + (int) DIV (parts, DAY) - 2;	/* 28 days in month + corections */
   
 	/* Time left for round date in corections */
-	parts_left_in_week = parts % WEEK;	/* 28 % 7 = 0 so only corections counts */
-	parts_left_in_day = parts % DAY;
-	week_day = parts_left_in_week / DAY;
+	parts_left_in_week = (int) MOD (parts, WEEK);	/* 28 % 7 = 0 so only corections counts */
+	parts_left_in_day = (int) MOD (parts, DAY);
+	week_day = DIVISION (parts_left_in_week / DAY);
   
-	/* Special cases of Molad Zaken */
-	if ((leap_left < 12 && week_day == 3
-	     && parts_left_in_day >= M (9 + 6, 204)) ||
-	    (leap_left < 7 && week_day == 2
-	     && parts_left_in_day >= M (15 + 6, 589)))
+	return hdate_postpone_new_year (days, week_day, parts_left_in_day, leap_left);
+}
+
+/**
+ @brief Julian days of 1 Tishrey of a Hebrew year and of the next one
+ 
+ Next year molad is 12 or 13 months after this year molad, so both
+ new years come out of a single molad evaluation.
+ 
+ @param hebrew_year The Hebrew year
+ @param jd_tishrey1 return the julian number of 1 Tishrey this year
+ @param jd_tishrey1_next_year return the julian number of 1 Tishrey next year
+ */
+void
+hdate_get_jd_tishrey1 (int hebrew_year, int *jd_tishrey1, int *jd_tishrey1_next_year)
+{
+	int years_from_3744;
+	int leap_months;
+	int leap_left;
+	int months;
+	parts_t parts;
+	int molad_day;
+	int days;
+	int parts_left_in_day;
+	int week_day;
+	int leap;
+	int carry;
+	
+	/* Start point for calculation is Molad new year 3744 (16BC) */
+	years_from_3744 = hebrew_year - 3744;
+	
+#ifndef HDATE_EXTENDED_RANGE
+	/* Before 3744 divisions round the wrong way, keep the plain path */
+	if (years_from_3744 < 0)
 	{
-		days++, week_day++;
+		*jd_tishrey1 = hdate_days_from_3744 (hebrew_year) + 1715119;
+		*jd_tishrey1_next_year = hdate_days_from_3744 (hebrew_year + 1) + 1715119;
+		return;
 	}
-  
-	/* ADU */
-	if (week_day == 1 || week_day == 4 || week_day == 6)
+#endif
+	
+	/* Time in months */
+	leap_months = DIV (years_from_3744 * 7 + 1, 19);	/* Number of leap months */
+	leap_left = (years_from_3744 * 7 + 1) - 19 * leap_months;	/* Months left of leap cycle */
+	months = years_from_3744 * 12 + leap_months;	/* Total Number of months */
+	
+	/* Time in parts and days */
+	parts = (parts_t) months * MONTH + M (1 + 6, 779);	/* Molad This year + Molad 3744 - corections */
+	molad_day = (int) DIV (parts, DAY);
+	days = months * 28 + molad_day - 2;	/* 28 days in month + corections */
+	parts_left_in_day = (int) (parts - (parts_t) molad_day * DAY);
+	week_day = (int) MOD (molad_day, 7);	/* 28 % 7 = 0 so only corections counts */
+	
+	*jd_tishrey1 = hdate_postpone_new_year (days, week_day, parts_left_in_day, leap_left) + 1715119;
+	
+	/* Step the molad to next year, 12 months are 12 * 28 + 18 days
+	   and 9516 parts, 13 months are 13 * 28 + 19 days and 23269 parts;
+	   without branches, scattered years would mispredict them */
+	leap = (leap_left >= 12); /* this year is leap */
+	leap_left += 7 - 19 * leap;
+	days += 12 * 28 + 18 + (28 + 1) * leap;
+	week_day += 4 + leap; /* 18 % 7 and 19 % 7 */
+	parts_left_in_day += 9516 + (23269 - 9516) * leap;
+	
+	/* carry a whole day, then week_day is at most 6 + 5 + 1 */
+	carry = (parts_left_in_day >= DAY);
+	parts_left_in_day -= DAY * carry;
+	days += carry;
+	week_day += carry;
+	if (week_day >= 7)
+		week_day -= 7;
+	
+	*jd_tishrey1_next_year = hdate_postpone_new_year (days, week_day, parts_left_in_day, leap_left) + 1715119;
+}
+
+/**
+ @brief Return Hebrew year type based on size and first week day of year.
+ 
+ year type | year length | Tishery 1 day of week
+ | 1       | 353         | 2 
+ | 2       | 353         | 7 
+ | 3       | 354         | 3 
+ | 4       | 354         | 5 
+ | 5       | 355         | 2 
+ | 6       | 355         | 5 
+ | 7       | 355         | 7 
+ | 8       | 383         | 2 
+ | 9       | 383         | 5 
+ |10       | 383         | 7 
+ |11       | 384         | 3 
+ |12       | 385         | 2 
+ |13       | 385         | 5 
+ |14       | 385         | 7 
+ 
+ @param size_of_year Length of year in days
+ @param new_year_dw First week day of year
+ @return A number for year type (1..14)
+ */
+int
+hdate_get_year_type (int size_of_year, int new_year_dw)
+{
+	/* Only 14 combinations of size and week day are posible; a byte
+	   each, packing two in a byte would slow down the lookup */
+	static const unsigned char year_types[24] =
+		{1, 0, 0, 2, 0, 3, 4, 0, 5, 0, 6, 7,
+		8, 0, 9, 10, 0, 11, 0, 0, 12, 0, 13, 14};
+	
+	int offset;
+	
+	/* convert size and first day to 1..24 number */
+	/* 2,3,5,7 -> 1,2,3,4 */
+	/* 353, 354, 355, 383, 384, 385 -> 0, 1, 2, 3, 4, 5 */
+	offset = (new_year_dw + 1) / 2;
+	offset = offset + 4 * ((size_of_year % 10 - 3) + (size_of_year / 10 - 35));
+	
+	/* some combinations are imposible */
+	if (offset < 1 || offset > 24)
+		return 0;
+	
+	return year_types[offset - 1];
+}
+
+/**
+ @brief Get the descriptor of a Hebrew year
+ 
+ @param hebrew_year The Hebrew year
+ @param info return the year descriptor
+ @return pointer to info
+ */
+hdate_year_info *
+hdate_get_year_info (int hebrew_year, hdate_year_info *info)
+{
+	hdate_year_info *cached;
+	int jd_tishrey1_next_year;
+#ifndef HDATE_NO_NEW_YEAR_TABLE
+	int entry;
+	
+	/* Years of the built in table need no molad arithmetic */
+	if (hebrew_year >= HDATE_NEW_YEAR_TABLE_FIRST_YEAR &&
+	    hebrew_year <= HDATE_NEW_YEAR_TABLE_LAST_YEAR)
 	{
-		days++;
+		entry = hdate_new_year_table[hebrew_year - HDATE_NEW_YEAR_TABLE_FIRST_YEAR];
+		info->year = hebrew_year;
+		info->jd_tishrey1 = HDATE_NEW_YEAR_TABLE_FIRST_JD +
+			365 * (hebrew_year - HDATE_NEW_YEAR_TABLE_FIRST_YEAR) + (entry >> 4);
+		info->year_type = entry & 0xf;
+		info->size_of_year = year_type_sizes[info->year_type - 1];
+		info->leap = (info->size_of_year > 355);
+		
+		return info;
 	}
-  
-	return days;
+#endif
+	
+	cached = &year_cache[hebrew_year & (YEAR_CACHE_SIZE - 1)];
+	
+	if (cached->size_of_year != 0 && cached->year == hebrew_year)
+	{
+		*info = *cached;
+		
+		return info;
+	}
+	
+	/* On a miss the slot is stored only once every field is computed */
+	info->year = hebrew_year;
+	hdate_get_jd_tishrey1 (hebrew_year, &info->jd_tishrey1, &jd_tishrey1_next_year);
+	info->size_of_year = jd_tishrey1_next_year - info->jd_tishrey1;
+	info->year_type = hdate_get_year_type (info->size_of_year,
+		MOD (info->jd_tishrey1 + 1, 7) + 1);
+	info->leap = (info->size_of_year > 355);
+	
+	*cached = *info;
+	
+	return info;
 }
 
 /**
@@ -249,11 +889,86 @@ hdate_days_from_3744 (int hebrew_year)
  hdate_string, and is subject to deprecation.
  [deprecation date 2011-12-28]
  */
-char *
+const char *
 hdate_get_month_string (int month) {
   if((month >0) && (month <=14)) {
     return hebrewMonthNames[month-1];
   } else {
     return "";
   }
-}
\ No newline at end of file
+}
+
+/**
+ @brief Write a number as a Hebrew numeral (gematria)
+ 
+ Days of the month come from a table, other numbers (e.g. years,
+ 5785 is התשפ"ה) are composed letter by letter. Nothing is allocated.
+ 
+ @param buffer at least HEBREW_NUMBER_BUFFER_SIZE bytes
+ @param n The number 1..10999
+ @param short_form A short flag, no geresh and gershayim.
+ @return the length of the string in bytes, 0 if n is out of range
+ */
+int
+hdate_format_hebrew_number (char *buffer, int n, int short_form)
+{
+	unsigned char letters[8];
+	char const *s;
+	int count = 0;
+	int len = 0;
+	int i;
+	
+	short_form = (short_form != 0);
+	
+	if (n < 1 || n >= 11000)
+	{
+		buffer[0] = '\0';
+		return 0;
+	}
+	
+	if (n <= 30)
+	{
+		for (s = hebrewDayNumbers[short_form][n - 1]; *s; s++)
+			buffer[len++] = *s;
+		buffer[len] = '\0';
+		return len;
+	}
+	
+	/* thousands, hundreds, tens and units, 15 and 16 are written 9+6 and 9+7 */
+	if (n >= 10000)
+		letters[count++] = hebrewTens[1];
+	if (n >= 1000 && (n / 1000) % 10)
+		letters[count++] = hebrewUnits[(n / 1000) % 10];
+	n %= 1000;
+	for (; n >= 400; n -= 400)
+		letters[count++] = hebrewHundreds[4];
+	if (n >= 100)
+		letters[count++] = hebrewHundreds[n / 100];
+	n %= 100;
+	if (n == 15 || n == 16)
+	{
+		letters[count++] = hebrewUnits[9];
+		letters[count++] = hebrewUnits[n - 9];
+	}
+	else
+	{
+		if (n >= 10)
+			letters[count++] = hebrewTens[n / 10];
+		if (n % 10)
+			letters[count++] = hebrewUnits[n % 10];
+	}
+	
+	for (i = 0; i < count; i++)
+	{
+		/* gershayim go before the last letter */
+		if (!short_form && i == count - 1 && count > 1)
+			buffer[len++] = '"';
+		buffer[len++] = (char) HEBREW_LETTER_LEAD;
+		buffer[len++] = (char) letters[i];
+	}
+	if (!short_form && count == 1)
+		buffer[len++] = '\'';
+	buffer[len] = '\0';
+	
+	return len;
+}
@@ -21,6 +21,39 @@
  *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#ifndef TBK_Jewish_Clock_hebrewdate_h
+#define TBK_Jewish_Clock_hebrewdate_h
+
+/** @struct hdate_year_info
+  @brief Descriptor of a Hebrew year, see hdate_get_year_info
+*/
+typedef struct
+{
+	/** The number of the hebrew year. */
+	int year;
+	/** The julian day number of 1 Tishrey this year. */
+	int jd_tishrey1;
+	/** The length of the year in days. */
+	int size_of_year;
+	/** The number type of year 1..14 (see hdate_get_year_type). */
+	int year_type;
+	/** True if the year has Adar I and Adar II. */
+	int leap;
+} hdate_year_info;
+
+/** @struct hdate_date
+  @brief Hebrew day, month and year, see hdate_jd_range_to_hdate
+*/
+typedef struct
+{
+	/** The number of day in the hebrew month (1..30). */
+	int day;
+	/** The number of the hebrew month 1..14 (1 - tishre, 13 - adar 1, 14 - adar 2). */
+	int month;
+	/** The number of the hebrew year. */
+	int year;
+} hdate_date;
+
 /**
  @brief Compute Julian day from Gregorian date
  
@@ -34,6 +67,43 @@
 int
 hdate_gdate_to_jd (int day, int month, int year);
 
+/**
+ @brief Compute Julian days from arrays of Gregorian dates
+ 
+ @param day Days of month 1..31
+ @param month Months 1..12
+ @param year Years in 4 digits e.g. 2001
+ @param count Number of dates
+ @param jd return count julian day numbers
+ */
+void
+hdate_gdate_to_jd_bulk (int const day[], int const month[], int const year[], int count, int jd[]);
+
+/**
+ @brief Compute Julian day from Hebrew day, month and year
+ 
+ @author Amos Shapir 1984 (rev. 1985, 1992) Yaacov Zamir 2003-2005
+ 
+ @param day Day of month 1..31
+ @param month Month 1..14 (13 - Adar 1, 14 - Adar 2)
+ @param year Hebrew year in 4 digits e.g. 5753
+ @param jd_tishrey1 return the julian number of 1 Tishrey this year
+ @param jd_tishrey1_next_year return the julian number of 1 Tishrey next year
+ @return the julian day number
+ */
+int
+hdate_hdate_to_jd (int day, int month, int year, int *jd_tishrey1, int *jd_tishrey1_next_year);
+
+/**
+ @brief Compute Julian days from an array of Hebrew dates
+ 
+ @param dates Hebrew dates to convert
+ @param count Number of dates
+ @param jd return count julian day numbers
+ */
+void
+hdate_hdate_to_jd_bulk (hdate_date const dates[], int count, int jd[]);
+
 /**
  @brief Converting from the Julian day to the Hebrew day
  
@@ -49,6 +119,19 @@ hdate_gdate_to_jd (int day, int month, int year);
 void
 hdate_jd_to_hdate (int jd, int *day, int *month, int *year, int *jd_tishrey1, int *jd_tishrey1_next_year);
 
+/**
+ @brief Converting a span of Julian days to Hebrew dates
+ 
+ The year is resolved once, then days, months and years are stepped
+ incrementally.
+ 
+ @param jd_start Julian day of the first date
+ @param count Number of consecutive days to convert
+ @param out return count Hebrew dates
+ */
+void
+hdate_jd_range_to_hdate (int jd_start, int count, hdate_date out[]);
+
 /**
  @brief Converting from the Julian day to the Gregorian date
  
@@ -62,6 +145,18 @@ hdate_jd_to_hdate (int jd, int *day, int *month, int *year, int *jd_tishrey1, in
 void
 hdate_jd_to_gdate (int jd, int *day, int *month, int *year);
 
+/**
+ @brief Converting from arrays of Julian days to Gregorian dates
+ 
+ @param jd Julian days
+ @param count Number of days
+ @param day return Days of month 1..31
+ @param month return Months 1..12
+ @param year return Years in 4 digits e.g. 2001
+ */
+void
+hdate_jd_to_gdate_bulk (int const jd[], int count, int day[], int month[], int year[]);
+
 /**
  @brief Days since Tishrey 3744
  
@@ -73,6 +168,41 @@ hdate_jd_to_gdate (int jd, int *day, int *month, int *year);
 int
 hdate_days_from_3744 (int hebrew_year);
 
+/**
+ @brief Julian days of 1 Tishrey of a Hebrew year and of the next one
+ 
+ Both new years come out of a single molad evaluation.
+ 
+ @param hebrew_year The Hebrew year
+ @param jd_tishrey1 return the julian number of 1 Tishrey this year
+ @param jd_tishrey1_next_year return the julian number of 1 Tishrey next year
+ */
+void
+hdate_get_jd_tishrey1 (int hebrew_year, int *jd_tishrey1, int *jd_tishrey1_next_year);
+
+/**
+ @brief Return Hebrew year type based on size and first week day of year.
+ 
+ @param size_of_year Length of year in days
+ @param new_year_dw First week day of year
+ @return the number for year type (1..14)
+ */
+int
+hdate_get_year_type (int size_of_year, int new_year_dw);
+
+/**
+ @brief Get the descriptor of a Hebrew year
+ 
+ Descriptors are kept in a small cache keyed by year, so repeated
+ conversions in the same year do not redo the molad arithmetic.
+ 
+ @param hebrew_year The Hebrew year
+ @param info return the year descriptor
+ @return pointer to info
+ */
+hdate_year_info *
+hdate_get_year_info (int hebrew_year, hdate_year_info *info);
+
 /**
  @brief Return a static string, with name of month.
  
@@ -82,5 +212,27 @@ hdate_days_from_3744 (int hebrew_year);
  hdate_string, and is subject to deprecation.
  [deprecation date 2011-12-28]
  */
-char *
+const char *
 hdate_get_month_string (int month);
+
+/** @def HEBREW_NUMBER_BUFFER_SIZE
+  @brief for hdate_format_hebrew_number, room for eight letters of two bytes
+  and the end of string
+*/
+#define HEBREW_NUMBER_BUFFER_SIZE 17
+
+/**
+ @brief Write a number as a Hebrew numeral (gematria)
+ 
+ Days of the month come from a table, other numbers (e.g. years,
+ 5785 is התשפ"ה) are composed letter by letter. Nothing is allocated.
+ 
+ @param buffer at least HEBREW_NUMBER_BUFFER_SIZE bytes
+ @param n The number 1..10999
+ @param short_form A short flag, no geresh and gershayim.
+ @return the length of the string in bytes, 0 if n is out of range
+ */
+int
+hdate_format_hebrew_number (char *buffer, int n, int short_form);
+
+#endif
@@ -0,0 +1,156 @@
+//
+//  bench_extended_range.c
+//  TBK_Jewish_Clock
+//
+//  The default build of src/hebrewdate.c (32 bits molad arithmetic)
+//  against the HDATE_EXTENDED_RANGE one, over years 3744..8000 where
+//  both are right: time per call of the molad functions and of
+//  hdate_jd_to_hdate, and whether both builds give the same results.
+//  With extended range off the default build expands the molad macros
+//  to the original int arithmetic, so its times are those of the fast
+//  path. Host tool, add -DHDATE_NO_NEW_YEAR_TABLE to time the molad
+//  path of hdate_jd_to_hdate in both builds:
+//
+//  cc -O2 -o bench_extended_range tools/bench_extended_range.c tools/bench_extended_range_64.c src/hebrewdate.c
+//  ./bench_extended_range
+//
+//  Exits with 1 if a result differs.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../src/hebrewdate.h"
+
+/* src/hebrewdate.c with HDATE_EXTENDED_RANGE, see bench_extended_range_64.c */
+int ext_hdate_days_from_3744 (int hebrew_year);
+void ext_hdate_get_jd_tishrey1 (int hebrew_year, int *jd_tishrey1, int *jd_tishrey1_next_year);
+void ext_hdate_jd_to_hdate (int jd, int *day, int *month, int *year, int *jd_tishrey1, int *jd_tishrey1_next_year);
+
+#define FIRST_YEAR 3744
+#define LAST_YEAR 8000
+
+#define COUNT (1 << 16)
+#define ROUNDS 200
+
+static int years[COUNT];
+static int jds[COUNT];
+
+static double
+seconds ()
+{
+	struct timespec ts;
+
+	clock_gettime (CLOCK_MONOTONIC, &ts);
+
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static double
+time_days_from_3744 (int (*days_from_3744) (int))
+{
+	volatile int sink = 0;
+	double start = seconds ();
+	int i, r;
+
+	for (r = 0; r < ROUNDS; r++)
+		for (i = 0; i < COUNT; i++)
+			sink += days_from_3744 (years[i]);
+
+	return (seconds () - start) * 1e9 / COUNT / ROUNDS;
+}
+
+static double
+time_jd_tishrey1 (void (*jd_tishrey1) (int, int *, int *))
+{
+	int a, b;
+	volatile int sink = 0;
+	double start = seconds ();
+	int i, r;
+
+	for (r = 0; r < ROUNDS; r++)
+		for (i = 0; i < COUNT; i++)
+		{
+			jd_tishrey1 (years[i], &a, &b);
+			sink += a + b;
+		}
+
+	return (seconds () - start) * 1e9 / COUNT / ROUNDS;
+}
+
+static double
+time_jd_to_hdate (void (*jd_to_hdate) (int, int *, int *, int *, int *, int *))
+{
+	int day, month, year, jd_tishrey1, jd_tishrey1_next_year;
+	volatile int sink = 0;
+	double start = seconds ();
+	int i, r;
+
+	for (r = 0; r < ROUNDS; r++)
+		for (i = 0; i < COUNT; i++)
+		{
+			jd_to_hdate (jds[i], &day, &month, &year, &jd_tishrey1, &jd_tishrey1_next_year);
+			sink += day;
+		}
+
+	return (seconds () - start) * 1e9 / COUNT / ROUNDS;
+}
+
+int
+main ()
+{
+	int first_jd, last_jd, unused;
+	int year, jd, i;
+	long mismatches = 0;
+
+	for (year = FIRST_YEAR; year <= LAST_YEAR; year++)
+	{
+		int a1, b1, a2, b2;
+
+		hdate_get_jd_tishrey1 (year, &a1, &b1);
+		ext_hdate_get_jd_tishrey1 (year, &a2, &b2);
+		if (a1 != a2 || b1 != b2 || hdate_days_from_3744 (year) != ext_hdate_days_from_3744 (year))
+		{
+			printf ("year %d differs\n", year);
+			mismatches++;
+		}
+	}
+
+	hdate_get_jd_tishrey1 (FIRST_YEAR, &first_jd, &unused);
+	hdate_get_jd_tishrey1 (LAST_YEAR, &unused, &last_jd);
+	last_jd--;
+	for (jd = first_jd; jd <= last_jd; jd++)
+	{
+		int d1, m1, y1, t1, n1;
+		int d2, m2, y2, t2, n2;
+
+		hdate_jd_to_hdate (jd, &d1, &m1, &y1, &t1, &n1);
+		ext_hdate_jd_to_hdate (jd, &d2, &m2, &y2, &t2, &n2);
+		if (d1 != d2 || m1 != m2 || y1 != y2 || t1 != t2 || n1 != n2)
+		{
+			if (mismatches < 20)
+				printf ("julian day %d differs\n", jd);
+			mismatches++;
+		}
+	}
+	printf ("%ld of %d years and %d julian days differ\n", mismatches,
+		LAST_YEAR - FIRST_YEAR + 1, last_jd - first_jd + 1);
+
+	/* years and days scattered through the range */
+	srand (1);
+	for (i = 0; i < COUNT; i++)
+	{
+		years[i] = FIRST_YEAR + rand () % (LAST_YEAR - FIRST_YEAR + 1);
+		jds[i] = first_jd + rand () % (last_jd - first_jd + 1);
+	}
+
+	printf ("hdate_days_from_3744  32 bits %6.1f ns, extended %6.1f ns\n",
+		time_days_from_3744 (hdate_days_from_3744), time_days_from_3744 (ext_hdate_days_from_3744));
+	printf ("hdate_get_jd_tishrey1 32 bits %6.1f ns, extended %6.1f ns\n",
+		time_jd_tishrey1 (hdate_get_jd_tishrey1), time_jd_tishrey1 (ext_hdate_get_jd_tishrey1));
+	printf ("hdate_jd_to_hdate     32 bits %6.1f ns, extended %6.1f ns\n",
+		time_jd_to_hdate (hdate_jd_to_hdate), time_jd_to_hdate (ext_hdate_jd_to_hdate));
+
+	return mismatches ? 1 : 0;
+}
@@ -0,0 +1,27 @@
+//
+//  bench_extended_range_64.c
+//  TBK_Jewish_Clock
+//
+//  src/hebrewdate.c built with the 64 bits molad arithmetic
+//  (HDATE_EXTENDED_RANGE) and its names moved aside, so
+//  tools/bench_extended_range.c can link both builds.
+//
+
+#define HDATE_EXTENDED_RANGE
+
+#define hdate_days_from_3744 ext_hdate_days_from_3744
+#define hdate_format_hebrew_number ext_hdate_format_hebrew_number
+#define hdate_gdate_to_jd ext_hdate_gdate_to_jd
+#define hdate_gdate_to_jd_bulk ext_hdate_gdate_to_jd_bulk
+#define hdate_get_jd_tishrey1 ext_hdate_get_jd_tishrey1
+#define hdate_get_month_string ext_hdate_get_month_string
+#define hdate_get_year_info ext_hdate_get_year_info
+#define hdate_get_year_type ext_hdate_get_year_type
+#define hdate_hdate_to_jd ext_hdate_hdate_to_jd
+#define hdate_hdate_to_jd_bulk ext_hdate_hdate_to_jd_bulk
+#define hdate_jd_range_to_hdate ext_hdate_jd_range_to_hdate
+#define hdate_jd_to_gdate ext_hdate_jd_to_gdate
+#define hdate_jd_to_gdate_bulk ext_hdate_jd_to_gdate_bulk
+#define hdate_jd_to_hdate ext_hdate_jd_to_hdate
+
+#include "../src/hebrewdate.c"
@@ -0,0 +1,89 @@
+//
+//  bench_gdate_bulk.c
+//  TBK_Jewish_Clock
+//
+//  Throughput of the bulk gregorian conversions against the scalar
+//  ones, in dates per second. Host tool, build it with the SIMD flags
+//  of the machine, e.g.:
+//
+//  cc -O2 -mavx2 -o bench_gdate_bulk tools/bench_gdate_bulk.c src/hebrewdate.c
+//  ./bench_gdate_bulk
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../src/hebrewdate.h"
+
+#define COUNT (1 << 20)
+#define ROUNDS 50
+
+static int jd[COUNT], jd_out[COUNT];
+static int day[COUNT], month[COUNT], year[COUNT];
+static int day_out[COUNT], month_out[COUNT], year_out[COUNT];
+
+static double
+seconds ()
+{
+	struct timespec ts;
+
+	clock_gettime (CLOCK_MONOTONIC, &ts);
+
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void
+report (const char *name, double elapsed)
+{
+	printf ("%-22s %8.1f M dates/s\n", name, (double) COUNT * ROUNDS / elapsed / 1e6);
+}
+
+int
+main ()
+{
+	int i, r;
+	double start;
+
+	/* random days between 1859 and 2406 */
+	srand (1);
+	for (i = 0; i < COUNT; i++)
+	{
+		jd[i] = 2400000 + rand () % 200000;
+		hdate_jd_to_gdate (jd[i], &day[i], &month[i], &year[i]);
+	}
+
+	start = seconds ();
+	for (r = 0; r < ROUNDS; r++)
+		for (i = 0; i < COUNT; i++)
+			jd_out[i] = hdate_gdate_to_jd (day[i], month[i], year[i]);
+	report ("hdate_gdate_to_jd", seconds () - start);
+
+	start = seconds ();
+	for (r = 0; r < ROUNDS; r++)
+		hdate_gdate_to_jd_bulk (day, month, year, COUNT, jd_out);
+	report ("hdate_gdate_to_jd_bulk", seconds () - start);
+
+	start = seconds ();
+	for (r = 0; r < ROUNDS; r++)
+		for (i = 0; i < COUNT; i++)
+			hdate_jd_to_gdate (jd[i], &day_out[i], &month_out[i], &year_out[i]);
+	report ("hdate_jd_to_gdate", seconds () - start);
+
+	start = seconds ();
+	for (r = 0; r < ROUNDS; r++)
+		hdate_jd_to_gdate_bulk (jd, COUNT, day_out, month_out, year_out);
+	report ("hdate_jd_to_gdate_bulk", seconds () - start);
+
+	/* the bulk results must match the scalar ones */
+	for (i = 0; i < COUNT; i++)
+	{
+		if (jd_out[i] != jd[i] || day_out[i] != day[i] || month_out[i] != month[i] || year_out[i] != year[i])
+		{
+			fprintf (stderr, "mismatch at julian day %d\n", jd[i]);
+			return 1;
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,160 @@
+//
+//  bench_hebrew_number.c
+//  TBK_Jewish_Clock
+//
+//  Hebrew numerals from hdate_format_hebrew_number against the previous
+//  hdate_string (HDATE_STRING_INT, ...) code, which allocated and
+//  concatenated from a digits table, and against hdate_string itself,
+//  for days of the month and for years. Checks that all give the same
+//  strings for 1..9999. Host tool:
+//
+//  cc -O2 -o bench_hebrew_number tools/bench_hebrew_number.c libhdate.experimental/hdate_strings.c libhdate.experimental/hdate_julian.c libhdate.experimental/hdate_holyday.c libhdate.experimental/hdate_parasha.c
+//  ./bench_hebrew_number
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "../libhdate.experimental/hdate.h"
+
+#define ROUNDS 200
+
+/* hdate_string (HDATE_STRING_INT, n, short_form, HDATE_STRING_HEBREW)
+   as it was before hdate_format_hebrew_number */
+static char *
+reference_hebrew_number (int n, int short_form)
+{
+	static char *digits[3][10] = {
+		{" ", "א", "ב", "ג", "ד", "ה", "ו", "ז", "ח", "ט"},
+		{"ט", "י", "כ", "ל", "מ", "נ", "ס", "ע", "פ", "צ"},
+		{" ", "ק", "ר", "ש", "ת"}
+	};
+	char *s;
+	int len;
+
+	s = malloc (HEBREW_NUMBER_BUFFER_SIZE);
+	if (s == NULL) return NULL;
+	s[0] = '\0';
+
+	if (n >= 1000)
+	{
+		strcat (s, digits[0][n / 1000]);
+		n %= 1000;
+	}
+	while (n >= 400)
+	{
+		strcat (s, digits[2][4]);
+		n -= 400;
+	}
+	if (n >= 100)
+	{
+		strcat (s, digits[2][n / 100]);
+		n %= 100;
+	}
+	if (n >= 10)
+	{
+		if (n == 15 || n == 16)
+			n -= 9;
+		strcat (s, digits[1][n / 10]);
+		n %= 10;
+	}
+	if (n > 0)
+		strcat (s, digits[0][n]);
+
+	if (!short_form)
+	{
+		len = strlen (s);
+		if (len <= 2) strcat (s, "'");
+		else
+		{
+			s[len + 1] = s[len];
+			s[len] = s[len - 1];
+			s[len - 1] = s[len - 2];
+			s[len - 2] = '\"';
+			s[len + 2] = '\0';
+		}
+	}
+
+	return s;
+}
+
+static double
+seconds ()
+{
+	struct timespec ts;
+
+	clock_gettime (CLOCK_MONOTONIC, &ts);
+
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void
+bench (const char *name, int first, int last)
+{
+	char buffer[HEBREW_NUMBER_BUFFER_SIZE];
+	volatile int sink = 0;
+	double start, reference_time, string_time, format_time;
+	char *s;
+	int n, r;
+
+	start = seconds ();
+	for (r = 0; r < ROUNDS; r++)
+		for (n = first; n <= last; n++)
+		{
+			s = reference_hebrew_number (n, HDATE_STRING_LONG);
+			sink += s[0];
+			free (s);
+		}
+	reference_time = seconds () - start;
+
+	start = seconds ();
+	for (r = 0; r < ROUNDS; r++)
+		for (n = first; n <= last; n++)
+		{
+			s = hdate_string (HDATE_STRING_INT, n, HDATE_STRING_LONG, HDATE_STRING_HEBREW);
+			sink += s[0];
+			free (s);
+		}
+	string_time = seconds () - start;
+
+	start = seconds ();
+	for (r = 0; r < ROUNDS; r++)
+		for (n = first; n <= last; n++)
+			sink += hdate_format_hebrew_number (buffer, n, HDATE_STRING_LONG);
+	format_time = seconds () - start;
+
+	printf ("%-6s previous %6.1f ns, hdate_string %6.1f ns, hdate_format_hebrew_number %6.1f ns\n", name,
+		reference_time * 1e9 / ROUNDS / (last - first + 1),
+		string_time * 1e9 / ROUNDS / (last - first + 1),
+		format_time * 1e9 / ROUNDS / (last - first + 1));
+}
+
+int
+main ()
+{
+	char buffer[HEBREW_NUMBER_BUFFER_SIZE];
+	int n, short_form;
+	char *reference, *s;
+
+	for (n = 1; n < 10000; n++)
+		for (short_form = 0; short_form < 2; short_form++)
+		{
+			reference = reference_hebrew_number (n, short_form);
+			s = hdate_string (HDATE_STRING_INT, n, short_form, HDATE_STRING_HEBREW);
+			hdate_format_hebrew_number (buffer, n, short_form);
+			if (strcmp (reference, buffer) != 0 || strcmp (s, buffer) != 0)
+			{
+				fprintf (stderr, "mismatch at %d: %s %s %s\n", n, reference, s, buffer);
+				return 1;
+			}
+			free (reference);
+			free (s);
+		}
+
+	bench ("days", 1, 30);
+	bench ("years", 5700, 5899);
+
+	return 0;
+}
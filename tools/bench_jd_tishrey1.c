@@ -0,0 +1,116 @@
+//
+//  bench_jd_tishrey1.c
+//  TBK_Jewish_Clock
+//
+//  1 Tishrey of a Hebrew year and of the next one from a single molad
+//  evaluation (hdate_get_jd_tishrey1) against two hdate_days_from_3744
+//  calls: both must give the same julian days for years -2000..8100,
+//  the integer divisions per pair of each (counted by the
+//  HDATE_COUNT_DIVISIONS build of tools/bench_jd_tishrey1_count.c) and
+//  the time per pair of each, for years in order and scattered.
+//  Host tool:
+//
+//  cc -O2 -o bench_jd_tishrey1 tools/bench_jd_tishrey1.c tools/bench_jd_tishrey1_count.c src/hebrewdate.c
+//  ./bench_jd_tishrey1
+//
+//  Exits with 1 if a year differs.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../src/hebrewdate.h"
+
+#define FIRST_YEAR -2000
+#define LAST_YEAR 8100
+
+#define COUNT (1 << 16)
+#define ROUNDS 200
+
+static int years[COUNT];
+
+extern long hdate_divisions;
+int count_hdate_days_from_3744 (int hebrew_year);
+void count_hdate_get_jd_tishrey1 (int hebrew_year, int *jd_tishrey1, int *jd_tishrey1_next_year);
+
+static double
+seconds ()
+{
+	struct timespec ts;
+
+	clock_gettime (CLOCK_MONOTONIC, &ts);
+
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int
+main ()
+{
+	int year, pattern, i, r;
+	int jd_tishrey1, jd_tishrey1_next_year;
+	long mismatches = 0;
+	volatile int sink = 0;
+	double start;
+
+	for (year = FIRST_YEAR; year <= LAST_YEAR; year++)
+	{
+		hdate_get_jd_tishrey1 (year, &jd_tishrey1, &jd_tishrey1_next_year);
+		if (jd_tishrey1 != hdate_days_from_3744 (year) + 1715119 ||
+		    jd_tishrey1_next_year != hdate_days_from_3744 (year + 1) + 1715119)
+		{
+			printf ("year %d: %d %d\n", year, jd_tishrey1, jd_tishrey1_next_year);
+			mismatches++;
+		}
+	}
+	printf ("%ld of %d years differ\n", mismatches, LAST_YEAR - FIRST_YEAR + 1);
+
+	/* the years before 3744 take the two calls path in both */
+	for (pattern = 0; pattern < 2; pattern++)
+	{
+		long divisions[2] = {0, 0};
+		int first_year = pattern ? 3744 : FIRST_YEAR;
+
+		for (year = first_year; year <= LAST_YEAR; year++)
+		{
+			hdate_divisions = 0;
+			count_hdate_days_from_3744 (year);
+			count_hdate_days_from_3744 (year + 1);
+			divisions[0] += hdate_divisions;
+
+			hdate_divisions = 0;
+			count_hdate_get_jd_tishrey1 (year, &jd_tishrey1, &jd_tishrey1_next_year);
+			divisions[1] += hdate_divisions;
+		}
+		printf ("years %d..%d divisions per pair: two hdate_days_from_3744 %.2f, hdate_get_jd_tishrey1 %.2f\n",
+			first_year, LAST_YEAR, (double) divisions[0] / (LAST_YEAR - first_year + 1),
+			(double) divisions[1] / (LAST_YEAR - first_year + 1));
+	}
+
+	/* the years of the usual range in order, then scattered */
+	for (pattern = 0; pattern < 2; pattern++)
+	{
+		srand (1);
+		for (i = 0; i < COUNT; i++)
+			years[i] = 5000 + (pattern ? rand () : i) % 1500;
+
+		start = seconds ();
+		for (r = 0; r < ROUNDS; r++)
+			for (i = 0; i < COUNT; i++)
+				sink += hdate_days_from_3744 (years[i]) + hdate_days_from_3744 (years[i] + 1);
+		printf ("%-9s two hdate_days_from_3744 %6.1f ns\n", pattern ? "scattered" : "in order",
+			(seconds () - start) * 1e9 / COUNT / ROUNDS);
+
+		start = seconds ();
+		for (r = 0; r < ROUNDS; r++)
+			for (i = 0; i < COUNT; i++)
+			{
+				hdate_get_jd_tishrey1 (years[i], &jd_tishrey1, &jd_tishrey1_next_year);
+				sink += jd_tishrey1 + jd_tishrey1_next_year;
+			}
+		printf ("%-9s hdate_get_jd_tishrey1    %6.1f ns\n", pattern ? "scattered" : "in order",
+			(seconds () - start) * 1e9 / COUNT / ROUNDS);
+	}
+
+	return mismatches ? 1 : 0;
+}
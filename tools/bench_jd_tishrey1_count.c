@@ -0,0 +1,27 @@
+//
+//  bench_jd_tishrey1_count.c
+//  TBK_Jewish_Clock
+//
+//  src/hebrewdate.c built counting its integer divisions
+//  (HDATE_COUNT_DIVISIONS) and its names moved aside, so
+//  tools/bench_jd_tishrey1.c can count and time the same code.
+//
+
+#define HDATE_COUNT_DIVISIONS
+
+#define hdate_days_from_3744 count_hdate_days_from_3744
+#define hdate_format_hebrew_number count_hdate_format_hebrew_number
+#define hdate_gdate_to_jd count_hdate_gdate_to_jd
+#define hdate_gdate_to_jd_bulk count_hdate_gdate_to_jd_bulk
+#define hdate_get_jd_tishrey1 count_hdate_get_jd_tishrey1
+#define hdate_get_month_string count_hdate_get_month_string
+#define hdate_get_year_info count_hdate_get_year_info
+#define hdate_get_year_type count_hdate_get_year_type
+#define hdate_hdate_to_jd count_hdate_hdate_to_jd
+#define hdate_hdate_to_jd_bulk count_hdate_hdate_to_jd_bulk
+#define hdate_jd_range_to_hdate count_hdate_jd_range_to_hdate
+#define hdate_jd_to_gdate count_hdate_jd_to_gdate
+#define hdate_jd_to_gdate_bulk count_hdate_jd_to_gdate_bulk
+#define hdate_jd_to_hdate count_hdate_jd_to_hdate
+
+#include "../src/hebrewdate.c"
@@ -0,0 +1,136 @@
+//
+//  bench_new_year_table.c
+//  TBK_Jewish_Clock
+//
+//  hdate_get_year_info and hdate_jd_to_hdate from the built in 1 Tishrey
+//  table (the default) against the molad arithmetic
+//  (HDATE_NO_NEW_YEAR_TABLE), for years scattered through 5600..6400:
+//  time per call of each, and whether they give the same results for
+//  every year and julian day of the table. Host tool:
+//
+//  cc -O2 -o bench_new_year_table tools/bench_new_year_table.c tools/bench_new_year_table_molad.c src/hebrewdate.c
+//  ./bench_new_year_table
+//
+//  Exits with 1 if a result differs.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../src/hebrewdate.h"
+
+/* src/hebrewdate.c without the table, see bench_new_year_table_molad.c */
+hdate_year_info *molad_hdate_get_year_info (int hebrew_year, hdate_year_info *info);
+void molad_hdate_jd_to_hdate (int jd, int *day, int *month, int *year, int *jd_tishrey1, int *jd_tishrey1_next_year);
+
+#define FIRST_YEAR 5600
+#define LAST_YEAR 6400
+
+#define COUNT (1 << 16)
+#define ROUNDS 200
+
+static int years[COUNT];
+static int jds[COUNT];
+
+static double
+seconds ()
+{
+	struct timespec ts;
+
+	clock_gettime (CLOCK_MONOTONIC, &ts);
+
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static double
+time_year_info (hdate_year_info *(*year_info) (int, hdate_year_info *))
+{
+	hdate_year_info info;
+	volatile int sink = 0;
+	double start = seconds ();
+	int i, r;
+
+	for (r = 0; r < ROUNDS; r++)
+		for (i = 0; i < COUNT; i++)
+		{
+			year_info (years[i], &info);
+			sink += info.jd_tishrey1;
+		}
+
+	return (seconds () - start) * 1e9 / COUNT / ROUNDS;
+}
+
+static double
+time_jd_to_hdate (void (*jd_to_hdate) (int, int *, int *, int *, int *, int *))
+{
+	int day, month, year, jd_tishrey1, jd_tishrey1_next_year;
+	volatile int sink = 0;
+	double start = seconds ();
+	int i, r;
+
+	for (r = 0; r < ROUNDS; r++)
+		for (i = 0; i < COUNT; i++)
+		{
+			jd_to_hdate (jds[i], &day, &month, &year, &jd_tishrey1, &jd_tishrey1_next_year);
+			sink += day;
+		}
+
+	return (seconds () - start) * 1e9 / COUNT / ROUNDS;
+}
+
+int
+main ()
+{
+	hdate_year_info a, b;
+	int first_jd, last_jd;
+	int year, jd, i;
+	long mismatches = 0;
+
+	/* every year and every julian day of the table */
+	for (year = FIRST_YEAR; year <= LAST_YEAR; year++)
+	{
+		hdate_get_year_info (year, &a);
+		molad_hdate_get_year_info (year, &b);
+		if (a.jd_tishrey1 != b.jd_tishrey1 || a.size_of_year != b.size_of_year ||
+		    a.year_type != b.year_type || a.leap != b.leap)
+		{
+			printf ("year %d differs\n", year);
+			mismatches++;
+		}
+	}
+
+	first_jd = hdate_get_year_info (FIRST_YEAR, &a)->jd_tishrey1;
+	last_jd = hdate_get_year_info (LAST_YEAR, &a)->jd_tishrey1 + a.size_of_year - 1;
+	for (jd = first_jd; jd <= last_jd; jd++)
+	{
+		int d1, m1, y1, t1, n1;
+		int d2, m2, y2, t2, n2;
+
+		hdate_jd_to_hdate (jd, &d1, &m1, &y1, &t1, &n1);
+		molad_hdate_jd_to_hdate (jd, &d2, &m2, &y2, &t2, &n2);
+		if (d1 != d2 || m1 != m2 || y1 != y2 || t1 != t2 || n1 != n2)
+		{
+			if (mismatches < 20)
+				printf ("julian day %d differs\n", jd);
+			mismatches++;
+		}
+	}
+	printf ("%ld of %d years and %d julian days differ\n", mismatches,
+		LAST_YEAR - FIRST_YEAR + 1, last_jd - first_jd + 1);
+
+	/* years and days scattered through the table */
+	srand (1);
+	for (i = 0; i < COUNT; i++)
+	{
+		years[i] = FIRST_YEAR + rand () % (LAST_YEAR - FIRST_YEAR + 1);
+		jds[i] = first_jd + rand () % (last_jd - first_jd + 1);
+	}
+
+	printf ("hdate_get_year_info molad %6.1f ns, table %6.1f ns\n",
+		time_year_info (molad_hdate_get_year_info), time_year_info (hdate_get_year_info));
+	printf ("hdate_jd_to_hdate   molad %6.1f ns, table %6.1f ns\n",
+		time_jd_to_hdate (molad_hdate_jd_to_hdate), time_jd_to_hdate (hdate_jd_to_hdate));
+
+	return mismatches ? 1 : 0;
+}
@@ -0,0 +1,27 @@
+//
+//  bench_new_year_table_molad.c
+//  TBK_Jewish_Clock
+//
+//  src/hebrewdate.c built with the molad arithmetic only
+//  (HDATE_NO_NEW_YEAR_TABLE) and its names moved aside, so
+//  tools/bench_new_year_table.c can link both modes.
+//
+
+#define HDATE_NO_NEW_YEAR_TABLE
+
+#define hdate_days_from_3744 molad_hdate_days_from_3744
+#define hdate_format_hebrew_number molad_hdate_format_hebrew_number
+#define hdate_gdate_to_jd molad_hdate_gdate_to_jd
+#define hdate_gdate_to_jd_bulk molad_hdate_gdate_to_jd_bulk
+#define hdate_get_jd_tishrey1 molad_hdate_get_jd_tishrey1
+#define hdate_get_month_string molad_hdate_get_month_string
+#define hdate_get_year_info molad_hdate_get_year_info
+#define hdate_get_year_type molad_hdate_get_year_type
+#define hdate_hdate_to_jd molad_hdate_hdate_to_jd
+#define hdate_hdate_to_jd_bulk molad_hdate_hdate_to_jd_bulk
+#define hdate_jd_range_to_hdate molad_hdate_jd_range_to_hdate
+#define hdate_jd_to_gdate molad_hdate_jd_to_gdate
+#define hdate_jd_to_gdate_bulk molad_hdate_jd_to_gdate_bulk
+#define hdate_jd_to_hdate molad_hdate_jd_to_hdate
+
+#include "../src/hebrewdate.c"
@@ -0,0 +1,93 @@
+//
+//  bench_packed_tables.c
+//  TBK_Jewish_Clock
+//
+//  Lookups in the bitpacked tables: hdate_get_year_type (YEAR_TYPE) over
+//  every year length and new year week day, scattered, and the reading
+//  rules of hdate_get_parasha (JOIN_FLAG) on the shabatot of years
+//  5600..6599, in both israel and diaspora. Build with the readings
+//  table turned off, so hdate_get_parasha goes through the rules.
+//  Host tool:
+//
+//  cc -O2 -DHDATE_NO_PARASHA_TABLE -o bench_packed_tables tools/bench_packed_tables.c libhdate.experimental/hdate_parasha.c libhdate.experimental/hdate_julian.c
+//  ./bench_packed_tables
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../libhdate.experimental/hdate.h"
+
+#define FIRST_YEAR 5600
+#define LAST_YEAR 6599
+
+#define COUNT (1 << 16)
+#define ROUNDS 200
+
+/* lengths and new year week days of the 14 year types */
+static const int sizes[14] = {353, 353, 354, 354, 355, 355, 355, 383, 383, 383, 384, 385, 385, 385};
+static const int week_days[14] = {2, 7, 3, 5, 2, 5, 7, 2, 5, 7, 3, 2, 5, 7};
+
+static int size_of_year[COUNT];
+static int new_year_dw[COUNT];
+
+static double
+seconds ()
+{
+	struct timespec ts;
+
+	clock_gettime (CLOCK_MONOTONIC, &ts);
+
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int
+main ()
+{
+	hdate_year_info info;
+	hdate_struct *shabatot;
+	int count = 0;
+	int year, days, i, r;
+	volatile int sink = 0;
+	double start;
+
+	srand (1);
+	for (i = 0; i < COUNT; i++)
+	{
+		r = rand () % 14;
+		size_of_year[i] = sizes[r];
+		new_year_dw[i] = week_days[r];
+	}
+
+	start = seconds ();
+	for (r = 0; r < ROUNDS; r++)
+		for (i = 0; i < COUNT; i++)
+			sink += hdate_get_year_type (size_of_year[i], new_year_dw[i]);
+	printf ("hdate_get_year_type        %6.2f ns\n", (seconds () - start) * 1e9 / COUNT / ROUNDS);
+
+	/* about 52 shabatot a year */
+	shabatot = malloc ((LAST_YEAR - FIRST_YEAR + 1) * 56 * sizeof (hdate_struct));
+	if (!shabatot)
+		return 1;
+	for (year = FIRST_YEAR; year <= LAST_YEAR; year++)
+	{
+		hdate_get_year_info (year, &info);
+		for (days = 0; days < info.size_of_year; days++)
+		{
+			hdate_set_jd (&shabatot[count], info.jd_tishrey1 + days);
+			if (shabatot[count].hd_dw == 7)
+				count++;
+		}
+	}
+
+	start = seconds ();
+	for (r = 0; r < ROUNDS / 20; r++)
+		for (i = 0; i < count; i++)
+			sink += hdate_get_parasha (&shabatot[i], 0) + hdate_get_parasha (&shabatot[i], 1);
+	printf ("hdate_get_parasha (rules)  %6.2f ns\n", (seconds () - start) * 1e9 / count / (ROUNDS / 20) / 2);
+
+	free (shabatot);
+
+	return 0;
+}
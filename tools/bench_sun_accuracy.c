@@ -0,0 +1,116 @@
+//
+//  bench_sun_accuracy.c
+//  TBK_Jewish_Clock
+//
+//  The accuracy tiers of the sun times (hdate_get_utc_sun_times_acc): time
+//  and cycles per full zmanim set of each tier, and how many times of
+//  the fixed and standard tiers differ from the precise one (which rounds
+//  where they truncate, so about half differ by a minute) over dates
+//  2000..2040, latitudes -60..60 and longitudes -180..180. Cycles are
+//  read from the time stamp counter on x86 hosts; with a hardware FPU
+//  the fixed tier is slower than the standard one, which says nothing
+//  of the watch (soft float). Host tool:
+//
+//  cc -O2 -o bench_sun_accuracy tools/bench_sun_accuracy.c src/hdate_sun_time.c src/hebrewdate.c src/my_math.c
+//  ./bench_sun_accuracy
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#if defined (__x86_64__) || defined (__i386__)
+#include <x86intrin.h>
+#define CYCLES() __rdtsc ()
+#else
+#define CYCLES() 0
+#endif
+
+#include "../src/hdate_sun_time.h"
+
+#define ROUNDS 100000
+#define TIERS 3
+
+static const char *tier_names[TIERS] = {"fixed", "standard", "precise"};
+
+static double
+seconds ()
+{
+	struct timespec ts;
+
+	clock_gettime (CLOCK_MONOTONIC, &ts);
+
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/* the zmanim of hdate_get_utc_sun_time_full at a tier */
+static void
+full (int tier, int day, int month, int year, double latitude, double longitude, int t[8])
+{
+	/* sunrise, sunset, alut ha-shachar, talit, tzeit hacochavim, shlosha cochavim */
+	static const double deg[6] = {90.833, 90.833, 106.01, 101.0, 96.0, 98.5};
+	static const int rise_set[6] = {HDATE_SUN_RISE, HDATE_SUN_SET,
+		HDATE_SUN_RISE, HDATE_SUN_RISE, HDATE_SUN_SET, HDATE_SUN_SET};
+
+	hdate_get_utc_sun_times_acc (day, month, year, latitude, longitude, deg, rise_set, 6, t, tier);
+	t[6] = (t[1] - t[0]) / 12;
+	t[7] = (t[1] + t[0]) / 2;
+}
+
+static void
+time_full (int tier, double *ns, double *cycles)
+{
+	int t[8];
+	volatile int sink = 0;
+	double start = seconds ();
+	unsigned long long start_cycles = CYCLES ();
+	int i;
+
+	for (i = 0; i < ROUNDS; i++)
+	{
+		full (tier, 1 + i % 28, 1 + i % 12, 2000 + i % 40, 31.78, 35.22, t);
+		sink += t[0];
+	}
+
+	*cycles = (double) (CYCLES () - start_cycles) / ROUNDS;
+	*ns = (seconds () - start) * 1e9 / ROUNDS;
+}
+
+int
+main ()
+{
+	int year, month, day, latitude, longitude, tier, i;
+	int precise[8], t[8];
+	long times = 0, differ[TIERS] = {0}, over_minute[TIERS] = {0}, worst[TIERS] = {0};
+	double ns, cycles;
+
+	for (year = 2000; year <= 2040; year++)
+		for (month = 1; month <= 12; month++)
+			for (day = 1; day <= 28; day += 3)
+				for (latitude = -60; latitude <= 60; latitude += 5)
+					for (longitude = -180; longitude <= 180; longitude += 45)
+					{
+						full (HDATE_SUN_ACCURACY_PRECISE, day, month, year, latitude, longitude, precise);
+						times += 8;
+
+						for (tier = 0; tier < TIERS; tier++)
+						{
+							full (tier, day, month, year, latitude, longitude, t);
+							for (i = 0; i < 8; i++)
+							{
+								if (t[i] != precise[i]) differ[tier]++;
+								if (abs (t[i] - precise[i]) > 1) over_minute[tier]++;
+								if (abs (t[i] - precise[i]) > worst[tier]) worst[tier] = abs (t[i] - precise[i]);
+							}
+						}
+					}
+
+	for (tier = 0; tier < TIERS; tier++)
+	{
+		time_full (tier, &ns, &cycles);
+		printf ("%-8s %7.1f ns %7.0f cycles per full set\n", tier_names[tier], ns, cycles);
+		printf ("         %ld of %ld times differ from precise, %ld by more than a minute, at most %ld\n",
+			differ[tier], times, over_minute[tier], worst[tier]);
+	}
+
+	return 0;
+}
@@ -0,0 +1,133 @@
+//
+//  bench_sun_fixed.c
+//  TBK_Jewish_Clock
+//
+//  Fixed point sun times (hdate_get_utc_sun_times_fixed) against the
+//  floating point ones (hdate_get_utc_sun_times): how many of the six
+//  zmanim altitudes differ over dates 2000..2040, latitudes -60..60 and
+//  longitudes -180..180, and the time and cycles per set of both paths.
+//  Cycles are read from the time stamp counter on x86 hosts, and from
+//  the DWT cycle counter on a Cortex-M3 without FPU like the watch,
+//  where the double path is soft float. Host tool:
+//
+//  cc -O2 -o bench_sun_fixed tools/bench_sun_fixed.c src/hdate_sun_time.c src/hebrewdate.c src/my_math.c
+//  ./bench_sun_fixed
+//
+//  Cortex-M3 build, output by semihosting (the counts run under
+//  qemu-system-arm -M lm3s6965evb -semihosting, the cycles need a board):
+//
+//  arm-none-eabi-gcc -O2 -mcpu=cortex-m3 -mthumb -mfloat-abi=soft --specs=rdimon.specs -o bench_sun_fixed.elf tools/bench_sun_fixed.c src/hdate_sun_time.c src/hebrewdate.c src/my_math.c -lrdimon
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#if defined (__x86_64__) || defined (__i386__)
+#include <x86intrin.h>
+#define CYCLES() __rdtsc ()
+#define ROUNDS 100000
+#elif defined (__ARM_ARCH_7M__)
+/* data watchpoint and trace cycle counter, 32 bits, started in main */
+#define DEMCR (*(volatile unsigned int *) 0xe000edfc)
+#define DWT_CTRL (*(volatile unsigned int *) 0xe0001000)
+#define DWT_CYCCNT (*(volatile unsigned int *) 0xe0001004)
+#define CYCLES() DWT_CYCCNT
+#define ROUNDS 1000
+#else
+#define CYCLES() 0
+#define ROUNDS 100000
+#endif
+
+#include "../src/hdate_sun_time.h"
+
+#define TIMES 6
+
+/* sunrise, sunset, alut ha-shachar, talit, tzeit hacochavim, shlosha cochavim */
+static const double deg[TIMES] = {90.833, 90.833, 106.01, 101.0, 96.0, 98.5};
+static const int deg_fixed[TIMES] = {90833, 90833, 106010, 101000, 96000, 98500};
+static const int rise_set[TIMES] = {HDATE_SUN_RISE, HDATE_SUN_SET,
+	HDATE_SUN_RISE, HDATE_SUN_RISE, HDATE_SUN_SET, HDATE_SUN_SET};
+
+static double
+seconds ()
+{
+#ifdef __ARM_ARCH_7M__
+	return (double) clock () / CLOCKS_PER_SEC;
+#else
+	struct timespec ts;
+
+	clock_gettime (CLOCK_MONOTONIC, &ts);
+
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+#endif
+}
+
+static void
+time_sets (int fixed, double *ns, double *cycles)
+{
+	int t[TIMES];
+	volatile int sink = 0;
+	double start = seconds ();
+	unsigned long long start_cycles = CYCLES ();
+	int i;
+
+	for (i = 0; i < ROUNDS; i++)
+	{
+		if (fixed)
+			hdate_get_utc_sun_times_fixed (1 + i % 28, 1 + i % 12, 2000 + i % 40, 31780, 35220,
+				deg_fixed, rise_set, TIMES, t);
+		else
+			hdate_get_utc_sun_times (1 + i % 28, 1 + i % 12, 2000 + i % 40, 31.78, 35.22,
+				deg, rise_set, TIMES, t);
+		sink += t[0];
+	}
+
+	*cycles = (double) (CYCLES () - start_cycles) / ROUNDS;
+	*ns = (seconds () - start) * 1e9 / ROUNDS;
+}
+
+int
+main ()
+{
+	int year, month, day, latitude, longitude, i;
+	int a[TIMES], b[TIMES];
+	long times = 0, differ = 0, worst = 0;
+	double ns, cycles;
+
+#ifdef __ARM_ARCH_7M__
+	/* trace enable, then a cycle counter from 0 */
+	DEMCR |= 1u << 24;
+	DWT_CYCCNT = 0;
+	DWT_CTRL |= 1;
+#endif
+
+	for (year = 2000; year <= 2040; year++)
+		for (month = 1; month <= 12; month++)
+			for (day = 1; day <= 28; day += 3)
+				for (latitude = -60000; latitude <= 60000; latitude += 2500)
+					for (longitude = -180000; longitude <= 180000; longitude += 22500)
+					{
+						hdate_get_utc_sun_times (day, month, year, latitude / 1000.0, longitude / 1000.0,
+							deg, rise_set, TIMES, a);
+						hdate_get_utc_sun_times_fixed (day, month, year, latitude, longitude,
+							deg_fixed, rise_set, TIMES, b);
+
+						for (i = 0; i < TIMES; i++)
+						{
+							/* the sun does not reach the altitude */
+							if (a[i] < -10000 || a[i] > 10000)
+								continue;
+							times++;
+							if (a[i] != b[i]) differ++;
+							if (abs (a[i] - b[i]) > worst) worst = abs (a[i] - b[i]);
+						}
+					}
+
+	printf ("%ld of %ld times differ, by at most %ld minutes\n", differ, times, worst);
+	time_sets (0, &ns, &cycles);
+	printf ("set of %d  double %6.1f ns %7.0f cycles\n", TIMES, ns, cycles);
+	time_sets (1, &ns, &cycles);
+	printf ("set of %d  fixed  %6.1f ns %7.0f cycles\n", TIMES, ns, cycles);
+
+	return 0;
+}
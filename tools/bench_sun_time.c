@@ -0,0 +1,111 @@
+//
+//  bench_sun_time.c
+//  TBK_Jewish_Clock
+//
+//  Sun times from the day of year table (the default) against the
+//  series (HDATE_NO_SUN_TABLE): time per ephemeris and per full zmanim
+//  set, and how many times differ, over dates 2000..2040 and latitudes
+//  -60..60. Host tool:
+//
+//  cc -O2 -o bench_sun_time tools/bench_sun_time.c tools/bench_sun_time_series.c src/hdate_sun_time.c src/hebrewdate.c src/my_math.c
+//  ./bench_sun_time
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../src/hdate_sun_time.h"
+
+/* src/hdate_sun_time.c with the series, see bench_sun_time_series.c */
+void series_hdate_get_sun_ephemeris (int day, int month, int year, hdate_sun_ephemeris *eph);
+void series_hdate_get_utc_sun_time_full (int day, int month, int year, double latitude, double longitude,
+	int *sun_hour, int *first_light, int *talit, int *sunrise,
+	int *midday, int *sunset, int *first_stars, int *three_stars);
+
+#define ROUNDS 100000
+
+typedef void (*full_function) (int, int, int, double, double,
+	int *, int *, int *, int *, int *, int *, int *, int *);
+
+static double
+seconds ()
+{
+	struct timespec ts;
+
+	clock_gettime (CLOCK_MONOTONIC, &ts);
+
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static double
+time_ephemeris (void (*ephemeris) (int, int, int, hdate_sun_ephemeris *))
+{
+	hdate_sun_ephemeris eph;
+	volatile double sink = 0;
+	double start = seconds ();
+	int i;
+
+	for (i = 0; i < ROUNDS; i++)
+	{
+		ephemeris (1 + i % 28, 1 + i % 12, 2000 + i % 40, &eph);
+		sink += eph.sin_decl;
+	}
+
+	return (seconds () - start) * 1e9 / ROUNDS;
+}
+
+static double
+time_full (full_function full)
+{
+	int t[8];
+	volatile int sink = 0;
+	double start = seconds ();
+	int i;
+
+	for (i = 0; i < ROUNDS; i++)
+	{
+		full (1 + i % 28, 1 + i % 12, 2000 + i % 40, 31.78, 35.22,
+			&t[0], &t[1], &t[2], &t[3], &t[4], &t[5], &t[6], &t[7]);
+		sink += t[3];
+	}
+
+	return (seconds () - start) * 1e9 / ROUNDS;
+}
+
+int
+main ()
+{
+	int year, month, day, latitude, i;
+	int a[8], b[8];
+	long times = 0, differ = 0, worst = 0;
+
+	for (year = 2000; year <= 2040; year++)
+		for (month = 1; month <= 12; month++)
+			for (day = 1; day <= 28; day += 3)
+				for (latitude = -60; latitude <= 60; latitude += 10)
+				{
+					series_hdate_get_utc_sun_time_full (day, month, year, latitude, 35.0,
+						&a[0], &a[1], &a[2], &a[3], &a[4], &a[5], &a[6], &a[7]);
+					hdate_get_utc_sun_time_full (day, month, year, latitude, 35.0,
+						&b[0], &b[1], &b[2], &b[3], &b[4], &b[5], &b[6], &b[7]);
+
+					for (i = 0; i < 8; i++)
+					{
+						/* the sun does not reach the altitude */
+						if (a[i] < -10000 || a[i] > 10000)
+							continue;
+						times++;
+						if (a[i] != b[i]) differ++;
+						if (abs (a[i] - b[i]) > worst) worst = abs (a[i] - b[i]);
+					}
+				}
+
+	printf ("%ld of %ld times differ, by at most %ld minutes\n", differ, times, worst);
+	printf ("ephemeris  series %6.1f ns, table %6.1f ns\n",
+		time_ephemeris (series_hdate_get_sun_ephemeris), time_ephemeris (hdate_get_sun_ephemeris));
+	printf ("full set   series %6.1f ns, table %6.1f ns\n",
+		time_full (series_hdate_get_utc_sun_time_full), time_full (hdate_get_utc_sun_time_full));
+
+	return 0;
+}
@@ -0,0 +1,23 @@
+//
+//  bench_sun_time_series.c
+//  TBK_Jewish_Clock
+//
+//  src/hdate_sun_time.c built with the series (HDATE_NO_SUN_TABLE) and
+//  its names moved aside, so tools/bench_sun_time.c can link both modes.
+//
+
+#define HDATE_NO_SUN_TABLE
+
+#define hdate_get_day_of_year series_hdate_get_day_of_year
+#define hdate_get_sun_ephemeris series_hdate_get_sun_ephemeris
+#define hdate_get_utc_sun_time series_hdate_get_utc_sun_time
+#define hdate_get_utc_sun_time_deg series_hdate_get_utc_sun_time_deg
+#define hdate_get_utc_sun_time_eph series_hdate_get_utc_sun_time_eph
+#define hdate_get_utc_sun_time_fixed series_hdate_get_utc_sun_time_fixed
+#define hdate_get_utc_sun_time_full series_hdate_get_utc_sun_time_full
+#define hdate_get_utc_sun_times series_hdate_get_utc_sun_times
+#define hdate_get_utc_sun_times_acc series_hdate_get_utc_sun_times_acc
+#define hdate_get_utc_sun_times_eph series_hdate_get_utc_sun_times_eph
+#define hdate_get_utc_sun_times_fixed series_hdate_get_utc_sun_times_fixed
+
+#include "../src/hdate_sun_time.c"
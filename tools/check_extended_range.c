@@ -0,0 +1,138 @@
+//
+//  check_extended_range.c
+//  TBK_Jewish_Clock
+//
+//  Checks the HDATE_EXTENDED_RANGE build of src/hebrewdate.c against
+//  the Hebrew calendar of Reingold and Dershowitz (Calendrical
+//  Calculations): 1 Tishrey and the length of every year of a range,
+//  and hdate_jd_to_hdate, hdate_hdate_to_jd and hdate_jd_range_to_hdate
+//  at the start, the middle and the end of each year. Host tool:
+//
+//  cc -O2 -DHDATE_EXTENDED_RANGE -o check_extended_range tools/check_extended_range.c src/hebrewdate.c
+//  ./check_extended_range [first_year last_year]
+//
+//  The default range is -100000..100000. Exits with 1 if any year
+//  differs.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../src/hebrewdate.h"
+
+/* Mismatches printed before only counting them */
+#define MAX_REPORTS 20
+
+/* Julian day number of R.D. 0 */
+#define RD_JD 1721425
+
+/* R.D. of 1 Tishrey AM 1, 7 October 3761 BCE (julian) */
+#define HEBREW_EPOCH (-1373427LL)
+
+static long long
+floor_div (long long a, long long b)
+{
+	return (a >= 0) ? a / b : (a - b + 1) / b;
+}
+
+static long long
+floor_mod (long long a, long long b)
+{
+	return a - b * floor_div (a, b);
+}
+
+/* Days from the epoch to the molad of Tishrey, with the molad zaken
+   and ADU delays */
+static long long
+hebrew_calendar_elapsed_days (long long year)
+{
+	long long months_elapsed = floor_div (235 * year - 234, 19);
+	long long parts_elapsed = 12084 + 13753 * months_elapsed;
+	long long day = 29 * months_elapsed + floor_div (parts_elapsed, 25920);
+
+	return (floor_mod (3 * (day + 1), 7) < 3) ? day + 1 : day;
+}
+
+/* Delays of the new year keeping the year length valid (GaTaRaD and BeTUTaKPaT) */
+static long long
+hebrew_year_length_correction (long long year)
+{
+	long long ny0 = hebrew_calendar_elapsed_days (year - 1);
+	long long ny1 = hebrew_calendar_elapsed_days (year);
+	long long ny2 = hebrew_calendar_elapsed_days (year + 1);
+
+	if (ny2 - ny1 == 356)
+		return 2;
+	if (ny1 - ny0 == 382)
+		return 1;
+
+	return 0;
+}
+
+/* Julian day number of 1 Tishrey of a Hebrew year */
+static long long
+hebrew_new_year (long long year)
+{
+	return HEBREW_EPOCH + hebrew_calendar_elapsed_days (year) +
+		hebrew_year_length_correction (year) + RD_JD;
+}
+
+/* Checks a julian day within its year against the expected year */
+static int
+check_day (int jd, int expected_year)
+{
+	hdate_date range[1];
+	int day, month, year;
+	int jd_tishrey1, jd_tishrey1_next_year;
+
+	hdate_jd_to_hdate (jd, &day, &month, &year, &jd_tishrey1, &jd_tishrey1_next_year);
+	if (year != expected_year || jd < jd_tishrey1 || jd >= jd_tishrey1_next_year)
+		return 0;
+	if (hdate_hdate_to_jd (day, month, year, NULL, NULL) != jd)
+		return 0;
+
+	hdate_jd_range_to_hdate (jd, 1, range);
+
+	return range[0].day == day && range[0].month == month && range[0].year == year;
+}
+
+int
+main (int argc, char *argv[])
+{
+	int first_year = -100000;
+	int last_year = 100000;
+	long mismatches = 0;
+	int year;
+
+	if (argc == 3)
+	{
+		first_year = atoi (argv[1]);
+		last_year = atoi (argv[2]);
+	}
+
+	for (year = first_year; year <= last_year; year++)
+	{
+		hdate_year_info info;
+		long long jd_tishrey1 = hebrew_new_year (year);
+		long long size_of_year = hebrew_new_year (year + 1) - jd_tishrey1;
+		int ok;
+
+		hdate_get_year_info (year, &info);
+		ok = info.jd_tishrey1 == jd_tishrey1 && info.size_of_year == size_of_year &&
+			check_day (info.jd_tishrey1, year) &&
+			check_day (info.jd_tishrey1 + info.size_of_year / 2, year) &&
+			check_day (info.jd_tishrey1 + info.size_of_year - 1, year);
+
+		if (!ok)
+		{
+			if (mismatches < MAX_REPORTS)
+				printf ("year %d: 1 Tishrey %d, %d days, reference %lld, %lld days\n", year,
+					info.jd_tishrey1, info.size_of_year, jd_tishrey1, size_of_year);
+			mismatches++;
+		}
+	}
+
+	printf ("%ld of %d years differ\n", mismatches, last_year - first_year + 1);
+
+	return mismatches ? 1 : 0;
+}
@@ -0,0 +1,112 @@
+//
+//  check_year_guess.c
+//  TBK_Jewish_Clock
+//
+//  Checks the Hebrew year guess of hdate_jd_to_hdate, taken from the
+//  mean year length, against the previous guess (the gregorian year of
+//  hdate_jd_to_gdate + 3760) over julian days 0..4000000: after the
+//  underestimate check both must give the same year, and the day must
+//  fall within it. libhdate.experimental/hdate_julian.c makes the same
+//  guess, tools/hdate_compare.c checks it against the core. Host tool:
+//
+//  cc -O2 -o check_year_guess tools/check_year_guess.c src/hebrewdate.c
+//  ./check_year_guess
+//
+//  Exits with 1 if a day outside the skipped ranges differs.
+//
+
+#include <stdio.h>
+
+#include "../src/hebrewdate.h"
+
+#define FIRST_JD 0
+#define LAST_JD 4000000
+
+/* Mismatches printed before only counting them */
+#define MAX_REPORTS 20
+
+typedef struct
+{
+	int first_jd;
+	int last_jd;
+	const char *reason;
+} skipped_range;
+
+/* Ranges where the previous path is not a reference */
+static const skipped_range skipped[] = {
+	{0, 116803, "Hebrew years up to -633, division of negative year offsets truncates: "
+		"the previous path returns day 0 or negative days, both guesses can be a year too high"},
+	{3313432, LAST_JD, "Hebrew years from 8120, the 32 bits molad parts overflow"},
+};
+
+#define SKIPPED (int) (sizeof (skipped) / sizeof (skipped[0]))
+
+/* The year of the previous hdate_jd_to_hdate */
+static int
+previous_year (int jd)
+{
+	hdate_year_info info;
+	int day, month, year;
+
+	hdate_jd_to_gdate (jd, &day, &month, &year);
+	year += 3760;
+
+	hdate_get_year_info (year, &info);
+	if (info.jd_tishrey1 + info.size_of_year <= jd)
+		year++;
+
+	return year;
+}
+
+/* Index of the skipped range of jd, -1 if it is checked */
+static int
+skipped_index (int jd)
+{
+	int i;
+
+	for (i = 0; i < SKIPPED; i++)
+		if (jd >= skipped[i].first_jd && jd <= skipped[i].last_jd)
+			return i;
+
+	return -1;
+}
+
+int
+main ()
+{
+	long skipped_mismatches[SKIPPED] = {0};
+	long mismatches = 0;
+	long checked = 0;
+	int jd, i;
+
+	for (jd = FIRST_JD; jd <= LAST_JD; jd++)
+	{
+		int day, month, year;
+		int jd_tishrey1, jd_tishrey1_next_year;
+		int index = skipped_index (jd);
+
+		hdate_jd_to_hdate (jd, &day, &month, &year, &jd_tishrey1, &jd_tishrey1_next_year);
+
+		if (index >= 0)
+		{
+			if (year != previous_year (jd))
+				skipped_mismatches[index]++;
+			continue;
+		}
+
+		checked++;
+		if (year != previous_year (jd) || jd < jd_tishrey1 || jd >= jd_tishrey1_next_year)
+		{
+			if (mismatches < MAX_REPORTS)
+				printf ("julian day %d: year %d, previous path %d\n", jd, year, previous_year (jd));
+			mismatches++;
+		}
+	}
+
+	for (i = 0; i < SKIPPED; i++)
+		printf ("skipped %d..%d (%ld differ): %s\n", skipped[i].first_jd, skipped[i].last_jd,
+			skipped_mismatches[i], skipped[i].reason);
+	printf ("%ld of %ld julian days differ\n", mismatches, checked);
+
+	return mismatches ? 1 : 0;
+}
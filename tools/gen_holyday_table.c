@@ -0,0 +1,118 @@
+//
+//  gen_holyday_table.c
+//  TBK_Jewish_Clock
+//
+//  Emits the per year type holyday lists used by hdate_get_holyday.
+//  The lists are computed with the holyday rules, so build this host
+//  tool with the table lookup turned off:
+//
+//  cc -DHDATE_NO_HOLYDAY_TABLE -o gen_holyday_table tools/gen_holyday_table.c libhdate.experimental/hdate_holyday.c libhdate.experimental/hdate_julian.c
+//  ./gen_holyday_table > libhdate.experimental/hdate_holyday_table.h
+//
+
+#include <stdio.h>
+
+#include "../libhdate.experimental/hdate.h"
+
+/* From Tishrey 5765 (September 2004) on, all the holydays that depend
+   on the gregorian year (Yom Ha'atzmaut rules of 2004, Jabotinsky day
+   of 2005) are in place, and a year's holydays only depend on its type */
+#define FIRST_YEAR 5765
+
+/* 32 days words of the days bitmaps, enough for 385 days */
+#define DAY_WORDS 13
+
+int
+main ()
+{
+	hdate_year_info info;
+	hdate_holyday_event events[HDATE_MAX_HOLYDAY_EVENTS];
+	int year_of_type[14];
+	int index[2 * 14 + 1];
+	unsigned int days[2 * 14][DAY_WORDS];
+	int rank[2 * 14][DAY_WORDS];
+	int list;
+	int word;
+	int diaspora;
+	int year_type;
+	int year;
+	int count;
+	int total = 0;
+	int i;
+	
+	/* The first year of each type */
+	for (year_type = 1; year_type <= 14; year_type++)
+	{
+		for (year = FIRST_YEAR; hdate_get_year_info (year, &info)->year_type != year_type; year++)
+			;
+		year_of_type[year_type - 1] = year;
+	}
+	
+	printf ("/* Generated by tools/gen_holyday_table.c, do not edit */\n\n");
+	printf ("/* Holydays of years from %d on, one list per [diaspora][year_type - 1]\n", FIRST_YEAR);
+	printf ("   in date order: (days since 1 tishrey, 1 based) << 6 | holyday */\n");
+	printf ("#define HDATE_HOLYDAY_TABLE_FIRST_YEAR %d\n\n", FIRST_YEAR);
+	printf ("static const unsigned short hdate_holyday_table[] = {");
+	
+	for (diaspora = 0; diaspora <= 1; diaspora++)
+	{
+		for (year_type = 1; year_type <= 14; year_type++)
+		{
+			count = hdate_get_holyday_events (year_of_type[year_type - 1], diaspora, events, HDATE_MAX_HOLYDAY_EVENTS);
+			if (count == HDATE_MAX_HOLYDAY_EVENTS)
+			{
+				fprintf (stderr, "year type %d has too many holydays\n", year_type);
+				return 1;
+			}
+			
+			list = diaspora * 14 + year_type - 1;
+			index[list] = total;
+			
+			/* bitmap of the holyday days, and events before each word */
+			for (word = 0; word < DAY_WORDS; word++)
+				days[list][word] = 0;
+			for (i = 0; i < count; i++)
+				days[list][events[i].days >> 5] |= 1u << (events[i].days & 31);
+			for (word = 0, i = 0; word < DAY_WORDS; word++)
+			{
+				rank[list][word] = i;
+				while (i < count && (events[i].days >> 5) == word)
+					i++;
+			}
+			
+			printf ("%s\n\t/* %s, year type %d (%d) */",
+				total ? "," : "", diaspora ? "diaspora" : "israel", year_type, year_of_type[year_type - 1]);
+			for (i = 0; i < count; i++)
+				printf ("%s0x%04x", (i % 8) ? ", " : (i ? ",\n\t" : "\n\t"),
+					(events[i].days << 6) | events[i].holyday);
+			total += count;
+		}
+	}
+	index[2 * 14] = total;
+	
+	printf ("\n};\n\n");
+	printf ("static const unsigned short hdate_holyday_table_index[%d] = {", 2 * 14 + 1);
+	for (i = 0; i <= 2 * 14; i++)
+		printf ("%s%d", (i % 14) ? ", " : (i ? ",\n\t" : "\n\t"), index[i]);
+	printf ("\n};\n\n");
+	
+	printf ("/* Bit (days & 31) of word (days >> 5) is set on holydays */\n");
+	printf ("static const unsigned int hdate_holyday_table_days[%d][%d] = {", 2 * 14, DAY_WORDS);
+	for (list = 0; list < 2 * 14; list++)
+	{
+		for (word = 0; word < DAY_WORDS; word++)
+			printf ("%s0x%08x", word ? ", " : (list ? "},\n\t{" : "\n\t{"), days[list][word]);
+	}
+	printf ("}\n};\n\n");
+	
+	printf ("/* Number of a list's events before each word of its bitmap */\n");
+	printf ("static const unsigned char hdate_holyday_table_rank[%d][%d] = {", 2 * 14, DAY_WORDS);
+	for (list = 0; list < 2 * 14; list++)
+	{
+		for (word = 0; word < DAY_WORDS; word++)
+			printf ("%s%d", word ? ", " : (list ? "},\n\t{" : "\n\t{"), rank[list][word]);
+	}
+	printf ("}\n};\n");
+	
+	return 0;
+}
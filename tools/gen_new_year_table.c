@@ -0,0 +1,66 @@
+//
+//  gen_new_year_table.c
+//  TBK_Jewish_Clock
+//
+//  Emits the packed 1 Tishrey table used by hdate_get_year_info.
+//  The table is computed with the molad arithmetic, so build this
+//  host tool with the table lookup turned off:
+//
+//  cc -DHDATE_NO_NEW_YEAR_TABLE -o gen_new_year_table tools/gen_new_year_table.c src/hebrewdate.c
+//  ./gen_new_year_table > src/hdate_new_year_table.h
+//  cp src/hdate_new_year_table.h libhdate.experimental/
+//
+
+#include <stdio.h>
+
+#include "../src/hebrewdate.h"
+
+#define FIRST_YEAR 5600
+#define LAST_YEAR 6400
+
+int
+main ()
+{
+	int year;
+	int first_jd;
+	int jd_tishrey1, jd_tishrey1_next_year;
+	int delta;
+	int year_type;
+	
+	/* Base line is the earliest new year moved back to FIRST_YEAR */
+	first_jd = 0x7fffffff;
+	for (year = FIRST_YEAR; year <= LAST_YEAR; year++)
+	{
+		hdate_get_jd_tishrey1 (year, &jd_tishrey1, &jd_tishrey1_next_year);
+		if (jd_tishrey1 - 365 * (year - FIRST_YEAR) < first_jd)
+			first_jd = jd_tishrey1 - 365 * (year - FIRST_YEAR);
+	}
+	
+	printf ("/* Generated by tools/gen_new_year_table.c, do not edit */\n\n");
+	printf ("/* 1 Tishrey of years %d..%d, one entry per year:\n", FIRST_YEAR, LAST_YEAR);
+	printf ("   (jd_tishrey1 - FIRST_JD - 365 * (year - FIRST_YEAR)) << 4 | year_type */\n");
+	printf ("#define HDATE_NEW_YEAR_TABLE_FIRST_YEAR %d\n", FIRST_YEAR);
+	printf ("#define HDATE_NEW_YEAR_TABLE_LAST_YEAR %d\n", LAST_YEAR);
+	printf ("#define HDATE_NEW_YEAR_TABLE_FIRST_JD %d\n\n", first_jd);
+	printf ("static const unsigned short hdate_new_year_table[%d] = {", LAST_YEAR - FIRST_YEAR + 1);
+	
+	for (year = FIRST_YEAR; year <= LAST_YEAR; year++)
+	{
+		hdate_get_jd_tishrey1 (year, &jd_tishrey1, &jd_tishrey1_next_year);
+		delta = jd_tishrey1 - first_jd - 365 * (year - FIRST_YEAR);
+		year_type = hdate_get_year_type (jd_tishrey1_next_year - jd_tishrey1, (jd_tishrey1 + 1) % 7 + 1);
+		
+		if (delta < 0 || delta > 4095 || year_type < 1)
+		{
+			fprintf (stderr, "year %d does not fit the table\n", year);
+			return 1;
+		}
+		
+		printf ("%s0x%04x", ((year - FIRST_YEAR) % 10) ? ", " : (year == FIRST_YEAR ? "\n\t" : ",\n\t"),
+			(delta << 4) | year_type);
+	}
+	
+	printf ("\n};\n");
+	
+	return 0;
+}
@@ -0,0 +1,77 @@
+//
+//  gen_parasha_table.c
+//  TBK_Jewish_Clock
+//
+//  Emits the shabat readings of each year type used by hdate_get_parasha.
+//  The readings are computed with the reading rules, so build this host
+//  tool with the table lookup turned off:
+//
+//  cc -DHDATE_NO_PARASHA_TABLE -o gen_parasha_table tools/gen_parasha_table.c libhdate.experimental/hdate_parasha.c libhdate.experimental/hdate_julian.c
+//  ./gen_parasha_table > libhdate.experimental/hdate_parasha_table.h
+//
+
+#include <stdio.h>
+
+#include "../libhdate.experimental/hdate.h"
+
+/* Readings do not depend on the gregorian year, any year of a type will do */
+#define FIRST_YEAR 5600
+
+/* Weeks of the longest year, 385 days starting on a shabat */
+#define WEEKS 56
+
+int
+main ()
+{
+	hdate_year_info info;
+	hdate_struct h;
+	unsigned char readings[14][2][WEEKS];
+	int year_type;
+	int year;
+	int diaspora;
+	int days;
+	int week;
+	
+	for (year_type = 1; year_type <= 14; year_type++)
+	{
+		for (year = FIRST_YEAR; hdate_get_year_info (year, &info)->year_type != year_type; year++)
+			;
+		
+		for (diaspora = 0; diaspora <= 1; diaspora++)
+		{
+			for (week = 0; week < WEEKS; week++)
+				readings[year_type - 1][diaspora][week] = 0;
+			
+			for (days = 1; days <= info.size_of_year; days++)
+			{
+				hdate_set_jd (&h, info.jd_tishrey1 + days - 1);
+				if (h.hd_dw == 7)
+					readings[year_type - 1][diaspora][h.hd_weeks - 1] = hdate_get_parasha (&h, diaspora);
+			}
+		}
+	}
+	
+	printf ("/* Generated by tools/gen_parasha_table.c, do not edit */\n\n");
+	printf ("/* Parasha read on the shabat of each week of the year, by\n");
+	printf ("   [year_type - 1][diaspora][hd_weeks - 1] */\n");
+	printf ("#define HDATE_PARASHA_TABLE_WEEKS %d\n\n", WEEKS);
+	printf ("static const unsigned char hdate_parasha_table[14][2][%d] = {", WEEKS);
+	
+	for (year_type = 1; year_type <= 14; year_type++)
+	{
+		for (diaspora = 0; diaspora <= 1; diaspora++)
+		{
+			printf ("%s\n\t\t/* year type %d, %s */",
+				diaspora ? "," : (year_type > 1 ? "\n\t},\n\t{" : "\n\t{"),
+				year_type, diaspora ? "diaspora" : "israel");
+			for (week = 0; week < WEEKS; week++)
+				printf ("%s%d", (week % 14) ? ", " : (week ? ",\n\t\t" : "\n\t\t{"),
+					readings[year_type - 1][diaspora][week]);
+			printf ("}");
+		}
+	}
+	
+	printf ("\n\t}\n};\n");
+	
+	return 0;
+}
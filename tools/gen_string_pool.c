@@ -0,0 +1,199 @@
+//
+//  gen_string_pool.c
+//  TBK_Jewish_Clock
+//
+//  Emits the string pool used by hdate_string: every day, parasha, month
+//  and holyday name once, strings that are the tail of a longer one
+//  sharing its bytes, and tables of 16 bits offsets into the pool.
+//  The names are read back from hdate_string, so build this host tool
+//  with the pool turned off (and without ENABLE_NLS):
+//
+//  cc -DHDATE_NO_STRING_POOL -o gen_string_pool tools/gen_string_pool.c libhdate.experimental/hdate_strings.c libhdate.experimental/hdate_julian.c libhdate.experimental/hdate_holyday.c libhdate.experimental/hdate_parasha.c
+//  ./gen_string_pool > libhdate.experimental/hdate_string_pool.h
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../libhdate.experimental/hdate.h"
+
+#define MAX_STRINGS 512
+#define MAX_POOL 65536
+
+/* One offsets table of the pool header, and its index range in hdate_string */
+typedef struct
+{
+	const char *name;
+	int type;
+	int first;
+	int size;
+	int hebrew_forms;
+} pool_table;
+
+static const pool_table tables[] = {
+	{"days", HDATE_STRING_DOW, 1, 7, 2},
+	{"parashaot", HDATE_STRING_PARASHA, 0, 62, 2},
+	{"hebrew_months", HDATE_STRING_HMONTH, 1, 14, 2},
+	{"gregorian_months", HDATE_STRING_GMONTH, 1, 12, 1},
+	{"holidays", HDATE_STRING_HOLIDAY, 1, 37, 2},
+};
+
+#define TABLES (int) (sizeof (tables) / sizeof (tables[0]))
+
+static const char *strings[MAX_STRINGS];
+static int string_count = 0;
+static int references = 0;
+
+static char pool[MAX_POOL];
+static int pool_size = 0;
+
+/* Index of s in strings, added if new */
+static int
+intern (const char *s)
+{
+	int i;
+
+	references++;
+	for (i = 0; i < string_count; i++)
+		if (strcmp (strings[i], s) == 0)
+			return i;
+
+	if (string_count == MAX_STRINGS)
+	{
+		fprintf (stderr, "gen_string_pool: more than %d strings\n", MAX_STRINGS);
+		exit (1);
+	}
+	strings[string_count] = s;
+
+	return string_count++;
+}
+
+/* hdate_string, with the parasha index 0 (never returned) as "" */
+static const char *
+table_string (int type, int index, int short_form, int hebrew_form)
+{
+	const char *s = hdate_string (type, index, short_form, hebrew_form);
+
+	return s ? s : "";
+}
+
+static int
+by_length (const void *a, const void *b)
+{
+	return (int) strlen (*(const char * const *) b) - (int) strlen (*(const char * const *) a);
+}
+
+/* Offset of s in the pool, at the tail of a string already placed or appended */
+static int
+pool_offset (const char *s)
+{
+	int len = strlen (s);
+	int end;
+
+	for (end = 0; end < pool_size; end += strlen (pool + end) + 1)
+	{
+		int end_len = strlen (pool + end);
+
+		if (end_len >= len && strcmp (pool + end + end_len - len, s) == 0)
+			return end + end_len - len;
+	}
+
+	if (pool_size + len + 1 > MAX_POOL)
+	{
+		fprintf (stderr, "gen_string_pool: pool larger than 16 bits offsets\n");
+		exit (1);
+	}
+	memcpy (pool + pool_size, s, len + 1);
+	pool_size += len + 1;
+
+	return pool_size - len - 1;
+}
+
+static void
+print_string (const char *s)
+{
+	printf ("\t\"");
+	for (; *s; s++)
+	{
+		if (*s == '"' || *s == '\\')
+			printf ("\\%c", *s);
+		else
+			putchar (*s);
+	}
+	printf ("\\0\"\n");
+}
+
+int
+main ()
+{
+	const char *sorted[MAX_STRINGS];
+	int table;
+	int hebrew_form;
+	int short_form;
+	int index;
+	int end;
+	int literal_bytes = 0;
+	int i;
+
+	/* collect the distinct strings */
+	for (table = 0; table < TABLES; table++)
+		for (hebrew_form = 0; hebrew_form < tables[table].hebrew_forms; hebrew_form++)
+			for (short_form = 0; short_form <= 1; short_form++)
+				for (index = 0; index < tables[table].size; index++)
+					intern (table_string (tables[table].type, index + tables[table].first,
+						short_form, hebrew_form));
+
+	/* place the longest first, so shorter strings can share their tails */
+	for (i = 0; i < string_count; i++)
+	{
+		sorted[i] = strings[i];
+		literal_bytes += strlen (strings[i]) + 1;
+	}
+	qsort (sorted, string_count, sizeof (sorted[0]), by_length);
+	for (i = 0; i < string_count; i++)
+		pool_offset (sorted[i]);
+
+	printf ("/* Generated by tools/gen_string_pool.c, do not edit */\n\n");
+	printf ("/* %d names, %d distinct (%d bytes), in a pool of %d bytes;\n",
+		references, string_count, literal_bytes, pool_size);
+	printf ("   the tables hold offsets into the pool, by the indexes of the\n");
+	printf ("   hdate_string tables of the same names */\n");
+	printf ("static const char hdate_string_pool[%d] =\n", pool_size);
+	for (end = 0; end < pool_size; end += strlen (pool + end) + 1)
+		print_string (pool + end);
+	printf ("\t;\n");
+
+	for (table = 0; table < TABLES; table++)
+	{
+		printf ("\nstatic const unsigned short hdate_pool_%s", tables[table].name);
+		if (tables[table].hebrew_forms > 1)
+			printf ("[2]");
+		printf ("[2][%d] = {\n", tables[table].size);
+
+		for (hebrew_form = 0; hebrew_form < tables[table].hebrew_forms; hebrew_form++)
+		{
+			if (tables[table].hebrew_forms > 1)
+				printf ("\t{\n");
+			for (short_form = 0; short_form <= 1; short_form++)
+			{
+				printf ("\t%s{", tables[table].hebrew_forms > 1 ? "\t" : "");
+				for (index = 0; index < tables[table].size; index++)
+				{
+					if (index && index % 12 == 0)
+						printf (",\n\t%s ", tables[table].hebrew_forms > 1 ? "\t" : "");
+					else if (index)
+						printf (", ");
+					printf ("%d", pool_offset (table_string (tables[table].type,
+							index + tables[table].first, short_form, hebrew_form)));
+				}
+				printf ("}%s\n", short_form ? "" : ",");
+			}
+			if (tables[table].hebrew_forms > 1)
+				printf ("\t}%s\n", hebrew_form ? "" : ",");
+		}
+		printf ("};\n");
+	}
+
+	return 0;
+}
@@ -0,0 +1,77 @@
+//
+//  gen_sun_table.c
+//  TBK_Jewish_Clock
+//
+//  Emits the sun ephemeris of each day of the year used by
+//  hdate_get_sun_ephemeris. The values come from the series, so build
+//  this host tool with the table lookup turned off:
+//
+//  cc -DHDATE_NO_SUN_TABLE -o gen_sun_table tools/gen_sun_table.c src/hdate_sun_time.c src/hebrewdate.c src/my_math.c
+//  ./gen_sun_table > src/hdate_sun_table.h
+//
+
+#include <stdio.h>
+
+#include "../src/hdate_sun_time.h"
+
+/* Fixed point scales, declination within +-0.41 radians and equation
+   of time within +-17 minutes both fit a short */
+#define DECL_ONE 32768
+#define EQTIME_ONE 1024
+
+/* Days 1..365 are in 2001, day 366 is the 366th day of 2004 */
+static void
+day_of_year_date (int day_of_year, int *day, int *month, int *year)
+{
+	static const int month_days[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+
+	*year = (day_of_year == 366) ? 2004 : 2001;
+	if (day_of_year == 366)
+	{
+		*day = 31;
+		*month = 12;
+		return;
+	}
+
+	for (*month = 1; day_of_year > month_days[*month - 1]; (*month)++)
+		day_of_year -= month_days[*month - 1];
+	*day = day_of_year;
+}
+
+static int
+round_fixed (double x, int one)
+{
+	x *= one;
+
+	return (int) (x < 0 ? x - 0.5 : x + 0.5);
+}
+
+int
+main ()
+{
+	hdate_sun_ephemeris eph;
+	int day_of_year;
+	int day, month, year;
+
+	printf ("/* Generated by tools/gen_sun_table.c, do not edit */\n\n");
+	printf ("/* Sun declination and equation of time of each day of the year,\n");
+	printf ("   by [day_of_year - 1]: {declination * HDATE_SUN_TABLE_DECL_ONE (radians),\n");
+	printf ("   eqtime * HDATE_SUN_TABLE_EQTIME_ONE (minutes)} */\n");
+	printf ("#define HDATE_SUN_TABLE_DECL_ONE %d\n", DECL_ONE);
+	printf ("#define HDATE_SUN_TABLE_EQTIME_ONE %d\n\n", EQTIME_ONE);
+	printf ("static const short hdate_sun_table[366][2] = {");
+
+	for (day_of_year = 1; day_of_year <= 366; day_of_year++)
+	{
+		day_of_year_date (day_of_year, &day, &month, &year);
+		hdate_get_sun_ephemeris (day, month, year, &eph);
+
+		printf ("%s{%d, %d}", (day_of_year - 1) % 6 ? ", " : "\n\t",
+			round_fixed (eph.decl, DECL_ONE), round_fixed (eph.eqtime, EQTIME_ONE));
+		if (day_of_year < 366 && day_of_year % 6 == 0)
+			printf (",");
+	}
+	printf ("\n};\n");
+
+	return 0;
+}
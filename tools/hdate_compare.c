@@ -0,0 +1,213 @@
+//
+//  hdate_compare.c
+//  TBK_Jewish_Clock
+//
+//  Runs the shipped core (src/hebrewdate.c) and libhdate.experimental
+//  over every julian day of a range, reports the days where they
+//  disagree and the time per call of each. Host tool:
+//
+//  cc -O2 -o hdate_compare tools/hdate_compare.c tools/hdate_compare_exp.c src/hebrewdate.c
+//  ./hdate_compare [first_jd last_jd]
+//
+//  The default range is 1 Jan 1000 .. 31 Dec 3000. Exits with 1 if any
+//  day differs.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../src/hebrewdate.h"
+
+/* libhdate.experimental, see hdate_compare_exp.c */
+int exp_hdate_gdate_to_jd (int day, int month, int year);
+int exp_hdate_hdate_to_jd (int day, int month, int year, int *jd_tishrey1, int *jd_tishrey1_next_year);
+void exp_hdate_jd_to_gdate (int jd, int *day, int *month, int *year);
+void exp_hdate_jd_to_hdate (int jd, int *day, int *month, int *year, int *jd_tishrey1, int *jd_tishrey1_next_year);
+
+/* Mismatches printed before only counting them */
+#define MAX_REPORTS 20
+
+typedef struct
+{
+	const char *name;
+	int (*core) (int jd);
+	int (*exp) (int jd);
+} compare_test;
+
+static int sink;
+
+static double
+seconds ()
+{
+	struct timespec ts;
+	
+	clock_gettime (CLOCK_MONOTONIC, &ts);
+	
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/* Timed calls, folded to an int so the calls are not optimized out */
+
+static int
+core_jd_to_hdate (int jd)
+{
+	int d, m, y, t1, t2;
+	
+	hdate_jd_to_hdate (jd, &d, &m, &y, &t1, &t2);
+	
+	return d + m + y + t1 + t2;
+}
+
+static int
+exp_jd_to_hdate (int jd)
+{
+	int d, m, y, t1, t2;
+	
+	exp_hdate_jd_to_hdate (jd, &d, &m, &y, &t1, &t2);
+	
+	return d + m + y + t1 + t2;
+}
+
+static int
+core_jd_to_gdate (int jd)
+{
+	int d, m, y;
+	
+	hdate_jd_to_gdate (jd, &d, &m, &y);
+	
+	return d + m + y;
+}
+
+static int
+exp_jd_to_gdate (int jd)
+{
+	int d, m, y;
+	
+	exp_hdate_jd_to_gdate (jd, &d, &m, &y);
+	
+	return d + m + y;
+}
+
+static int
+core_hdate_to_jd (int jd)
+{
+	return hdate_hdate_to_jd (jd % 30 + 1, jd % 12 + 1, 5000 + jd % 1000, NULL, NULL);
+}
+
+static int
+exp_hdate_to_jd (int jd)
+{
+	return exp_hdate_hdate_to_jd (jd % 30 + 1, jd % 12 + 1, 5000 + jd % 1000, NULL, NULL);
+}
+
+static int
+core_gdate_to_jd (int jd)
+{
+	return hdate_gdate_to_jd (jd % 28 + 1, jd % 12 + 1, 1000 + jd % 2000);
+}
+
+static int
+exp_gdate_to_jd (int jd)
+{
+	return exp_hdate_gdate_to_jd (jd % 28 + 1, jd % 12 + 1, 1000 + jd % 2000);
+}
+
+static const compare_test tests[] = {
+	{"hdate_jd_to_hdate", core_jd_to_hdate, exp_jd_to_hdate},
+	{"hdate_jd_to_gdate", core_jd_to_gdate, exp_jd_to_gdate},
+	{"hdate_hdate_to_jd", core_hdate_to_jd, exp_hdate_to_jd},
+	{"hdate_gdate_to_jd", core_gdate_to_jd, exp_gdate_to_jd},
+};
+
+static double
+ns_per_call (int (*func) (int jd), int first_jd, int last_jd)
+{
+	double start;
+	int jd;
+	
+	start = seconds ();
+	for (jd = first_jd; jd <= last_jd; jd++)
+		sink += func (jd);
+	
+	return (seconds () - start) * 1e9 / (last_jd - first_jd + 1);
+}
+
+static void
+report (int jd, const char *what, int core, int exp, long *mismatches)
+{
+	if (++*mismatches <= MAX_REPORTS)
+		printf ("jd %d: %s core %d experimental %d\n", jd, what, core, exp);
+}
+
+int
+main (int argc, char *argv[])
+{
+	int first_jd = 2086308;	/* 1 Jan 1000 */
+	int last_jd = 2817151;	/* 31 Dec 3000 */
+	long mismatches = 0;
+	int jd;
+	int d, m, y, t1, t2;
+	int e_d, e_m, e_y, e_t1, e_t2;
+	int back, e_back;
+	unsigned int i;
+	
+	if (argc == 3)
+	{
+		first_jd = atoi (argv[1]);
+		last_jd = atoi (argv[2]);
+	}
+	if ((argc != 1 && argc != 3) || first_jd > last_jd)
+	{
+		fprintf (stderr, "usage: %s [first_jd last_jd]\n", argv[0]);
+		return 2;
+	}
+	
+	for (jd = first_jd; jd <= last_jd; jd++)
+	{
+		hdate_jd_to_hdate (jd, &d, &m, &y, &t1, &t2);
+		exp_hdate_jd_to_hdate (jd, &e_d, &e_m, &e_y, &e_t1, &e_t2);
+		
+		if (d != e_d)
+			report (jd, "hebrew day", d, e_d, &mismatches);
+		if (m != e_m)
+			report (jd, "hebrew month", m, e_m, &mismatches);
+		if (y != e_y)
+			report (jd, "hebrew year", y, e_y, &mismatches);
+		if (t1 != e_t1)
+			report (jd, "jd of 1 Tishrey", t1, e_t1, &mismatches);
+		if (t2 != e_t2)
+			report (jd, "jd of next 1 Tishrey", t2, e_t2, &mismatches);
+		
+		/* and back from the hebrew date */
+		back = hdate_hdate_to_jd (d, m, y, NULL, NULL);
+		e_back = exp_hdate_hdate_to_jd (e_d, e_m, e_y, NULL, NULL);
+		if (back != jd || e_back != jd)
+			report (jd, "hebrew date back to jd", back, e_back, &mismatches);
+		
+		hdate_jd_to_gdate (jd, &d, &m, &y);
+		exp_hdate_jd_to_gdate (jd, &e_d, &e_m, &e_y);
+		
+		if (d != e_d)
+			report (jd, "gregorian day", d, e_d, &mismatches);
+		if (m != e_m)
+			report (jd, "gregorian month", m, e_m, &mismatches);
+		if (y != e_y)
+			report (jd, "gregorian year", y, e_y, &mismatches);
+		
+		back = hdate_gdate_to_jd (d, m, y);
+		e_back = exp_hdate_gdate_to_jd (e_d, e_m, e_y);
+		if (back != jd || e_back != jd)
+			report (jd, "gregorian date back to jd", back, e_back, &mismatches);
+	}
+	
+	printf ("%d julian days, %ld mismatches\n\n", last_jd - first_jd + 1, mismatches);
+	
+	printf ("%-20s %10s %14s\n", "ns/call", "core", "experimental");
+	for (i = 0; i < sizeof (tests) / sizeof (tests[0]); i++)
+		printf ("%-20s %10.1f %14.1f\n", tests[i].name,
+			ns_per_call (tests[i].core, first_jd, last_jd),
+			ns_per_call (tests[i].exp, first_jd, last_jd));
+	
+	return mismatches ? 1 : 0;
+}
@@ -0,0 +1,20 @@
+//
+//  hdate_compare_exp.c
+//  TBK_Jewish_Clock
+//
+//  libhdate.experimental/hdate_julian.c with the names it shares with
+//  src/hebrewdate.c moved aside, so tools/hdate_compare.c can link both.
+//
+
+#define hdate_days_from_3744 exp_hdate_days_from_3744
+#define hdate_gdate_to_jd exp_hdate_gdate_to_jd
+#define hdate_get_jd_tishrey1 exp_hdate_get_jd_tishrey1
+#define hdate_get_year_info exp_hdate_get_year_info
+#define hdate_get_year_type exp_hdate_get_year_type
+#define hdate_hdate_to_jd exp_hdate_hdate_to_jd
+#define hdate_hdate_to_jd_bulk exp_hdate_hdate_to_jd_bulk
+#define hdate_jd_range_to_hdate exp_hdate_jd_range_to_hdate
+#define hdate_jd_to_gdate exp_hdate_jd_to_gdate
+#define hdate_jd_to_hdate exp_hdate_jd_to_hdate
+
+#include "../libhdate.experimental/hdate_julian.c"
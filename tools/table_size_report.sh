@@ -0,0 +1,53 @@
+#!/bin/sh
+#
+#  table_size_report.sh
+#  TBK_Jewish_Clock
+#
+#  Size of the static tables of the calendar code, split into writable
+#  data (RAM) and read-only data (flash). Uses the Pebble cross compiler
+#  when it is on the path, CC otherwise:
+#
+#  sh tools/table_size_report.sh
+#  CC=cc CFLAGS=-DHDATE_NO_STRING_POOL sh tools/table_size_report.sh
+#
+#  Note that the Pebble loads the whole app image into RAM, so there
+#  the totals of both columns count.
+#
+
+top=$(cd "$(dirname "$0")/.." && pwd)
+out=$(mktemp -d)
+trap 'rm -rf "$out"' EXIT
+
+if [ -z "$CC" ]; then
+	if command -v arm-none-eabi-gcc > /dev/null; then
+		CC="arm-none-eabi-gcc -mcpu=cortex-m3 -mthumb"
+		NM=arm-none-eabi-nm
+	else
+		CC=cc
+	fi
+fi
+NM=${NM:-nm}
+
+printf "%-40s %6s %6s\n" "table" "ram" "flash"
+
+for source in src/hebrewdate.c src/hdate_sun_time.c libhdate.experimental/hdate_julian.c \
+	libhdate.experimental/hdate_holyday.c libhdate.experimental/hdate_parasha.c \
+	libhdate.experimental/hdate_strings.c
+do
+	object="$out/$(basename "$source" .c).o"
+	$CC -Os $CFLAGS -c "$top/$source" -o "$object" || exit 1
+
+	# objects with a size: d/b are writable data, r is read-only data
+	$NM -S -t d --size-sort "$object" | awk -v file="$(basename "$source")" '
+		NF == 4 && $3 ~ /^[dDbBrR]$/ {
+			ram = ($3 ~ /[dDbB]/) ? $2 + 0 : 0
+			flash = ($3 ~ /[rR]/) ? $2 + 0 : 0
+			printf "%-40s %6d %6d\n", file ":" $4, ram, flash
+		}'
+
+	# string literals, which have no symbol
+	size=$(${NM%nm}size -A "$object" | awk '$1 ~ /^\.rodata\.str/ { total += $2 } END { print total + 0 }')
+	printf "%-40s %6d %6d\n" "$(basename "$source"):(string literals)" 0 "$size"
+done | awk '
+	{ print; ram += $2; flash += $3 }
+	END { printf "%-40s %6d %6d\n", "total", ram, flash }'